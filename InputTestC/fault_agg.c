@@ -0,0 +1,142 @@
+/**
+ * @file fault_agg.c
+ * @brief Fault 집계 + 대응 엔진 구현
+ */
+
+#include "fault_agg.h"
+#include <stdio.h>
+
+/* ===== 대응 태스크 (예제 — 실제 출력 제어로 교체) ===== */
+
+static void react_blank_display(void) {
+  printf("[AGG] reaction: blank display\n");
+}
+
+static void react_restore_display(void) {
+  printf("[AGG] reaction: restore display\n");
+}
+
+static void react_reset_gmsl(void) {
+  printf("[AGG] reaction: reset GMSL link\n");
+}
+
+static void react_enter_safe(void) {
+  printf("[AGG] reaction: enter safe state\n");
+}
+
+/* ===== 설정 ===== */
+
+/* 채널별 기본 심각도 (단독 latched 시 시스템 상태) */
+static const fault_sys_state_t s_default_sev[FAULT_CH_MAX] = {
+  [FAULT_CH_LCD]   = FAULT_SYS_DEGRADED,
+  [FAULT_CH_LED]   = FAULT_SYS_DEGRADED,
+  [FAULT_CH_GMSL]  = FAULT_SYS_DEGRADED,
+  [FAULT_CH_SCHED] = FAULT_SYS_SAFE,
+};
+
+/* 조합 규칙 (최대 8개 — 만족 여부를 uint8_t 비트로 보관) */
+static const fault_rule_t s_rules[] = {
+  { FAULT_BIT(FAULT_CH_LCD),                            FAULT_SYS_DEGRADED, react_blank_display, react_restore_display },
+  { FAULT_BIT(FAULT_CH_GMSL),                           FAULT_SYS_DEGRADED, react_reset_gmsl,    NULL },
+  { FAULT_BIT(FAULT_CH_LCD) | FAULT_BIT(FAULT_CH_LED),  FAULT_SYS_SAFE,     react_enter_safe,    NULL },
+  { FAULT_BIT(FAULT_CH_LCD) | FAULT_BIT(FAULT_CH_GMSL) | FAULT_BIT(FAULT_CH_SCHED),
+                                                        FAULT_SYS_SHUTDOWN, NULL,                NULL },
+};
+
+#define RULE_COUNT ((uint8_t)(sizeof(s_rules) / sizeof(s_rules[0])))
+_Static_assert(sizeof(s_rules) / sizeof(s_rules[0]) <= 8, "fault_agg: too many rules");
+_Static_assert(FAULT_CH_MAX <= 8, "fault_agg: latched mask is 8 bits");
+
+/* ===== 전역 변수 ===== */
+static fault_sys_state_t s_sev[FAULT_CH_MAX];
+static uint8_t s_sev_count[FAULT_SYS_MAX];   // 심각도별 latched 채널 수
+static uint8_t s_latched = 0;                // FAULT_BIT 마스크
+static uint8_t s_matched = 0;                // 만족된 규칙 비트
+static fault_sys_state_t s_state = FAULT_SYS_NORMAL;
+
+static const char* const s_state_names[FAULT_SYS_MAX] = {
+  "NORMAL", "DEGRADED", "SAFE", "SHUTDOWN",
+};
+
+/* ===== 내부 함수 ===== */
+
+/* 규칙 재평가 + 상태 도출 (latch 변화 시에만) */
+static void fault_agg_update(void) {
+  fault_sys_state_t st = FAULT_SYS_NORMAL;
+  for (int s = FAULT_SYS_MAX - 1; s > FAULT_SYS_NORMAL; --s) {
+    if (s_sev_count[s]) { st = (fault_sys_state_t)s; break; }
+  }
+
+  uint8_t matched = 0;
+  for (uint8_t r = 0; r < RULE_COUNT; ++r) {
+    const fault_rule_t* rule = &s_rules[r];
+    if ((s_latched & rule->mask) != rule->mask) continue;
+    matched |= (uint8_t)(1u << r);
+    if (rule->state > st) st = rule->state;
+  }
+
+  /* 규칙 에지 → 대응 태스크 예약 */
+  uint8_t rose = matched & (uint8_t)~s_matched;
+  uint8_t fell = s_matched & (uint8_t)~matched;
+  for (uint8_t r = 0; r < RULE_COUNT; ++r) {
+    const fault_rule_t* rule = &s_rules[r];
+    task_fn_t fn = (rose & (1u << r)) ? rule->on_enter : (fell & (1u << r)) ? rule->on_exit : NULL;
+    if (fn && sch_post_oneshot(fn, 0) != 0) {
+      printf("[AGG] reaction dropped (no slot) [rule=%u]\n", r);
+    }
+  }
+  s_matched = matched;
+
+  if (st != s_state) {
+    printf("[AGG] state %s -> %s [mask=0x%02x]\n", s_state_names[s_state], s_state_names[st], s_latched);
+    s_state = st;
+  }
+}
+
+/* ===== Public API ===== */
+
+void fault_agg_init(void) {
+  for (int ch = 0; ch < FAULT_CH_MAX; ++ch) s_sev[ch] = s_default_sev[ch];
+  for (int s = 0; s < FAULT_SYS_MAX; ++s) s_sev_count[s] = 0;
+  s_latched = 0;
+  s_matched = 0;
+  s_state = FAULT_SYS_NORMAL;
+}
+
+void fault_agg_on_change(uint8_t ch, bool latched) {
+  if (ch >= FAULT_CH_MAX) return;
+  uint8_t bit = (uint8_t)FAULT_BIT(ch);
+  if (latched == ((s_latched & bit) != 0)) return;  // 중복 통지
+
+  if (latched) {
+    s_latched |= bit;
+    s_sev_count[s_sev[ch]]++;
+  } else {
+    s_latched &= (uint8_t)~bit;
+    s_sev_count[s_sev[ch]]--;
+  }
+  fault_agg_update();
+}
+
+int fault_agg_set_severity(uint8_t ch, fault_sys_state_t sev) {
+  if (ch >= FAULT_CH_MAX || sev >= FAULT_SYS_MAX) return -2;
+  if (s_latched & FAULT_BIT(ch)) {
+    s_sev_count[s_sev[ch]]--;
+    s_sev_count[sev]++;
+  }
+  s_sev[ch] = sev;
+  fault_agg_update();
+  return 0;
+}
+
+fault_sys_state_t fault_agg_state(void) {
+  return s_state;
+}
+
+uint8_t fault_agg_latched_mask(void) {
+  return s_latched;
+}
+
+const char* fault_agg_state_name(fault_sys_state_t st) {
+  return (st < FAULT_SYS_MAX) ? s_state_names[st] : "?";
+}
@@ -0,0 +1,81 @@
+/**
+ * @file fault_agg.h
+ * @brief Fault 집계 + 심각도 기반 시스템 상태 / 대응 엔진
+ * @details - 채널별 심각도(설정 가능) 와 채널 조합 규칙으로 시스템 상태 도출
+ *            상태 = max(latched 채널 심각도, 만족된 조합 규칙의 상태)
+ *          - latch 변화 시에만 증분 갱신 (매 틱 재평가 없음)
+ *          - 규칙이 새로 만족/해제될 때 대응 함수를 1회성 태스크로 예약
+ */
+#ifndef FAULT_AGG_H
+#define FAULT_AGG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fault_input.h"
+#include "sch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 시스템 상태 (= 심각도, 값이 클수록 심각)
+ */
+typedef enum {
+  FAULT_SYS_NORMAL = 0,   ///< 정상
+  FAULT_SYS_DEGRADED,     ///< 기능 저하 운전
+  FAULT_SYS_SAFE,         ///< 안전 상태 (출력 제한)
+  FAULT_SYS_SHUTDOWN,     ///< 정지
+  FAULT_SYS_MAX
+} fault_sys_state_t;
+
+#define FAULT_BIT(ch)  (1u << (ch))
+
+/**
+ * @brief 조합 규칙 — mask 의 채널이 모두 latched 이면 state 이상
+ */
+typedef struct {
+  uint8_t           mask;      ///< FAULT_BIT(ch) 조합
+  fault_sys_state_t state;     ///< 만족 시 최소 시스템 상태
+  task_fn_t         on_enter;  ///< 만족 시 1회성 태스크 (NULL 가능)
+  task_fn_t         on_exit;   ///< 해제 시 1회성 태스크 (NULL 가능)
+} fault_rule_t;
+
+/**
+ * @brief 집계 상태 초기화 (init_fault_detection 에서 호출)
+ */
+void fault_agg_init(void);
+
+/**
+ * @brief latch 변화 통지 (process_single_fault 에서 상태 전환 시 호출)
+ * @param ch      fault_channel_t
+ * @param latched true: latched, false: cleared
+ */
+void fault_agg_on_change(uint8_t ch, bool latched);
+
+/**
+ * @brief 채널 심각도 변경 (즉시 재평가)
+ * @return 0: 성공, -2: 잘못된 파라미터
+ */
+int fault_agg_set_severity(uint8_t ch, fault_sys_state_t sev);
+
+/**
+ * @brief 현재 시스템 상태
+ */
+fault_sys_state_t fault_agg_state(void);
+
+/**
+ * @brief 현재 latched 채널 비트마스크 (FAULT_BIT)
+ */
+uint8_t fault_agg_latched_mask(void);
+
+/**
+ * @brief 상태 이름 (로그용)
+ */
+const char* fault_agg_state_name(fault_sys_state_t st);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FAULT_AGG_H
@@ -1,4 +1,9 @@
 #include "fault_input.h"
+#include "trace.h"
+#include "fault_log.h"
+#include "fault_agg.h"
+#include "sched_input.h"
+#include "sched_port.h"
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -10,6 +15,8 @@ volatile uint8_t gmslErrorCount = 0;
 volatile uint8_t lcdErrorClearCount = 0;
 volatile uint8_t ledErrorClearCount = 0;
 volatile uint8_t gmslErrorClearCount = 0;
+volatile uint8_t schedErrorCount = 0;
+volatile uint8_t schedErrorClearCount = 0;
 
 /* ===== Fault 상태 (State Machine) ===== */
 typedef enum {
@@ -20,6 +27,25 @@ typedef enum {
 static fault_state_t lcdState = FAULT_STATE_NORMAL;
 static fault_state_t ledState = FAULT_STATE_NORMAL;
 static fault_state_t gmslState = FAULT_STATE_NORMAL;
+static fault_state_t schedState = FAULT_STATE_NORMAL;
+static int schedReportCount = 0;  // 데드라인 보고 횟수 (로그용)
+
+/* ===== Fault 통계 (장기 누적) ===== */
+typedef struct {
+    fault_ch_stats_t pub;
+    uint32_t hist;              // 최근 원시 입력 비트열 (LSB = 최신)
+    uint32_t latch_start;       // 현재 latched 구간 시작 틱
+} fault_stat_acc_t;
+
+static fault_stat_acc_t s_fstat[FAULT_CH_MAX];
+
+#define FAULT_CHATTER_MASK \
+    ((FAULT_CHATTER_WINDOW >= 32) ? 0xFFFFFFFFUL : ((1UL << FAULT_CHATTER_WINDOW) - 1UL))
+
+_Static_assert(FAULT_CHATTER_WINDOW >= 2 && FAULT_CHATTER_WINDOW <= 32, "FAULT_CHATTER_WINDOW: 2..32");
+
+/* 외부 스케줄러 변수 */
+extern volatile uint32_t g_tick_ms;
 
 /*
 * description : Fault 입력 처리 모듈
@@ -111,21 +137,93 @@ void reset_dummy_counter(void) {
     dummy_counter = 0;
 }
 
-/* ===== Input Sampling (동일 시점 스냅샷) ===== */
+#if !defined(__AVR__)
+#ifndef FAULT_SIM_GLITCH_MS
+#define FAULT_SIM_GLITCH_MS 0   // > 0: 이 간격마다 한 틱 동안 모든 fault 입력 반전 (오버샘플링 확인용)
+#endif
+
+static void sim_put_pin(uint8_t *port, uint8_t pin, bool level) {
+    uint8_t mask = (uint8_t)(1u << SC_IN_BIT_OF(pin));
+    if (level) port[SC_IN_PORT_OF(pin)] |= mask;
+    else       port[SC_IN_PORT_OF(pin)] &= (uint8_t)~mask;
+}
+
+/* 호스트: 더미 데이터의 현재 행을 가상 입력 포트로 공급 (틱마다 캡처됨) */
+static void sim_fault_pins(uint8_t *port) {
+    // ! Todo Test 용도! 추후 삭제 필요
+    int index = dummy_counter % TEST_DATA_LENGTH;
+    sim_put_pin(port, FAULT_PIN_LCD, dummy_test_data[FAULT_INPUT_LCD][index]);
+    sim_put_pin(port, FAULT_PIN_LED, dummy_test_data[FAULT_INPUT_LED][index]);
+    sim_put_pin(port, FAULT_PIN_GMSL, dummy_test_data[FAULT_INPUT_GMSL][index]);
+#if FAULT_SIM_GLITCH_MS > 0
+    if (g_tick_ms % FAULT_SIM_GLITCH_MS == 0) {
+        for (int i = 0; i < FAULT_INPUT_MAX; ++i) {
+            static const uint8_t pins[FAULT_INPUT_MAX] = { FAULT_PIN_LCD, FAULT_PIN_LED, FAULT_PIN_GMSL };
+            port[SC_IN_PORT_OF(pins[i])] ^= (uint8_t)(1u << SC_IN_BIT_OF(pins[i]));
+        }
+    }
+#endif
+}
+#endif
+
+/* ===== Input Sampling (오버샘플링 + 다수결) ===== */
+
+_Static_assert(FAULT_OS_N_LCD >= 1 && FAULT_OS_N_LCD <= 32, "FAULT_OS_N_LCD: 1..32");
+_Static_assert(FAULT_OS_N_LED >= 1 && FAULT_OS_N_LED <= 32, "FAULT_OS_N_LED: 1..32");
+_Static_assert(FAULT_OS_N_GMSL >= 1 && FAULT_OS_N_GMSL <= 32, "FAULT_OS_N_GMSL: 1..32");
+
+static const uint8_t s_os_pin[FAULT_INPUT_MAX] = { FAULT_PIN_LCD, FAULT_PIN_LED, FAULT_PIN_GMSL };
+static const uint8_t s_os_n[FAULT_INPUT_MAX]   = { FAULT_OS_N_LCD, FAULT_OS_N_LED, FAULT_OS_N_GMSL };
+
+static uint32_t s_os_bits[FAULT_INPUT_MAX];   // 서브샘플 비트열 (LSB = 최신, 1 = fault)
+static uint8_t  s_os_fill;                    // 직전 다수결 이후 모인 서브샘플 수 (최대 32)
+static bool     s_os_vote[FAULT_INPUT_MAX];   // 직전 판정 (짝수 N 동률 시 유지)
+
+void fault_input_sample_task(void) {
+    sc_in_snap_t in;
+    if (!sc_in_get(&in)) return;
+    for (int i = 0; i < FAULT_INPUT_MAX; ++i) {
+        s_os_bits[i] = (s_os_bits[i] << 1) | sc_in_pin(&in, s_os_pin[i]);
+    }
+    s_os_fill += (uint8_t)(s_os_fill < 32);
+}
 
 /**
- * @brief 모든 fault 입력을 동일 시점에 샘플링
- * @return fault_inputs_t 구조체 (스냅샷)
+ * @brief 채널 1개 다수결
+ * @param n 사용할 서브샘플 수 (최근 n 개, 1..32)
+ * @details 과반이면 그 레벨, 동률이면 직전 판정. 소수 쪽 서브샘플 수를 글리치로 누적
+ */
+static bool os_vote(int i, uint8_t n) {
+    uint32_t mask = (n >= 32) ? 0xFFFFFFFFUL : ((1UL << n) - 1UL);
+    uint8_t ones = (uint8_t)__builtin_popcountl(s_os_bits[i] & mask);
+    uint8_t zeros = (uint8_t)(n - ones);
+    if (ones != zeros) s_os_vote[i] = (ones > zeros);
+    s_fstat[i].pub.os_rejected += (ones < zeros) ? ones : zeros;
+    return s_os_vote[i];
+}
+
+/**
+ * @brief 모든 fault 입력을 동일 구간 다수결로 샘플링
+ * @details 직전 호출 이후 fault_input_sample_task() 가 모은 서브샘플 중 최근 N(채널별) 개로 판정.
+ *          아직 서브샘플이 없으면 이번 틱 스냅샷 1개를 그대로 쓴다.
+ * @return fault_inputs_t 구조체 (캡처 전이면 모두 정상)
  */
 static fault_inputs_t read_fault_inputs_snapshot(void) {
-    fault_inputs_t snapshot;
-    
-    // ! Todo Test 용도! 추후 삭제 필요
-    int index = dummy_counter % TEST_DATA_LENGTH;
-    // ! TODO : 
-    snapshot.lcd_fault = dummy_test_data[FAULT_INPUT_LCD][index];
-    snapshot.led_fault = dummy_test_data[FAULT_INPUT_LED][index];
-    snapshot.gmsl_fault = dummy_test_data[FAULT_INPUT_GMSL][index];
+    fault_inputs_t snapshot = { false, false, false };
+    bool level[FAULT_INPUT_MAX] = { false, false, false };
+    sc_in_snap_t in;
+
+    if (s_os_fill) {
+        for (int i = 0; i < FAULT_INPUT_MAX; ++i) {
+            level[i] = os_vote(i, (s_os_n[i] < s_os_fill) ? s_os_n[i] : s_os_fill);
+        }
+        s_os_fill = 0;   // 다음 판정은 새 서브샘플만
+    } else if (sc_in_get(&in)) {
+        for (int i = 0; i < FAULT_INPUT_MAX; ++i) level[i] = sc_in_pin(&in, s_os_pin[i]);
+    }
+    snapshot.lcd_fault = level[FAULT_INPUT_LCD];
+    snapshot.led_fault = level[FAULT_INPUT_LED];
+    snapshot.gmsl_fault = level[FAULT_INPUT_GMSL];
     
     // ! TODO : 나중에 지울것..
     dummy_counter++;
@@ -142,6 +240,7 @@ static fault_inputs_t read_fault_inputs_snapshot(void) {
  * @param clear_count   클리어 카운터 (입출력)
  * @param state         현재 상태 (입출력)
  * @param name          fault 이름 (디버깅)
+ * @param ch            fault 채널 (트레이스)
  * @param tick          현재 틱 (디버깅용)
  */
 static void process_single_fault(
@@ -150,11 +249,25 @@ static void process_single_fault(
     volatile uint8_t *clear_count,
     fault_state_t *state,
     const char *name,
+    fault_channel_t ch,
     int tick
 ) {
-    if (!error_count || !clear_count || !state || !name) {
+    if (!error_count || !clear_count || !state || !name || ch >= FAULT_CH_MAX) {
         return;
     } 
+
+    // 통계: 분기 없는 누적 (토글 = 직전 샘플과 XOR, 채터 = 창 안 토글 수)
+    fault_stat_acc_t *acc = &s_fstat[ch];
+    uint32_t raw = has_fault ? 1u : 0u;
+    uint32_t hist = (acc->hist << 1) | raw;
+    uint32_t edges = (hist ^ (hist >> 1)) & (FAULT_CHATTER_MASK >> 1);
+    uint8_t chatter = (uint8_t)(__builtin_popcountl(edges) >= FAULT_CHATTER_TOGGLES);
+    acc->pub.samples++;
+    acc->pub.raw_faults += raw;
+    acc->pub.toggles += (uint32_t)(edges & 1u) & (uint32_t)(acc->pub.samples > 1);
+    acc->pub.chatter_events += (uint16_t)(chatter & (uint8_t)~acc->pub.chattering);
+    acc->pub.chattering = chatter;
+    acc->hist = hist;
     
     if (has_fault) {
         // 에러 감지
@@ -167,6 +280,12 @@ static void process_single_fault(
         if (*error_count >= FAULT_LATCH_THRESHOLD && *state == FAULT_STATE_NORMAL) {
             printf("[FAULT] %s Error detected (latched) [count=%d, tick=%d]\n", name, *error_count, tick);
             *state = FAULT_STATE_ERROR_LATCHED;
+            trace_event(TRACE_EV_FAULT_LATCH, (uint8_t)ch);
+            fault_log_append((uint8_t)ch, FLOG_EV_LATCH);   // 기록은 idle 에서 커밋
+            fault_agg_on_change((uint8_t)ch, true);
+            acc->pub.latch_events++;
+            acc->pub.latched = 1;
+            acc->latch_start = g_tick_ms;
         }
     } else {
         // 정상 감지
@@ -180,6 +299,13 @@ static void process_single_fault(
         if (*clear_count >= FAULT_LATCH_THRESHOLD && *state == FAULT_STATE_ERROR_LATCHED) {
             printf("[CLEAR] %s Error cleared [count=%d, tick=%d]\n", name, *clear_count, tick);
             *state = FAULT_STATE_NORMAL;
+            trace_event(TRACE_EV_FAULT_CLEAR, (uint8_t)ch);
+            fault_log_append((uint8_t)ch, FLOG_EV_CLEAR);
+            fault_agg_on_change((uint8_t)ch, false);
+            uint32_t dur = g_tick_ms - acc->latch_start;
+            acc->pub.time_latched_ms += dur;
+            if (dur > acc->pub.longest_ms) acc->pub.longest_ms = dur;
+            acc->pub.latched = 0;
         }
     }
 }
@@ -200,6 +326,7 @@ void fault_input_10ms_task(void){
         &lcdErrorClearCount, 
         &lcdState, 
         "LCD",
+        FAULT_CH_LCD,
         tick // ! 니증에 Tick 제거 할것
     );
     
@@ -209,6 +336,7 @@ void fault_input_10ms_task(void){
         &ledErrorClearCount, 
         &ledState, 
         "LED",
+        FAULT_CH_LED,
         tick // ! 니증에 Tick 제거 할것
     );
     
@@ -218,10 +346,26 @@ void fault_input_10ms_task(void){
         &gmslErrorClearCount, 
         &gmslState, 
         "GMSL",
+        FAULT_CH_GMSL,
         tick // ! 니증에 Tick 제거 할것
     );
 }
 
+/**
+ * @brief 스케줄러 데드라인 결과 보고 (supervisor → fault latch)
+ */
+void fault_input_report_deadline(bool missed) {
+    process_single_fault(
+        missed,
+        &schedErrorCount,
+        &schedErrorClearCount,
+        &schedState,
+        "SCHED",
+        FAULT_CH_SCHED,
+        schedReportCount++
+    );
+}
+
 /**
  * @brief Fault 시스템 초기화
  */
@@ -232,10 +376,60 @@ void init_fault_detection(void) {
     lcdErrorClearCount = 0;
     ledErrorClearCount = 0;
     gmslErrorClearCount = 0;
+    schedErrorCount = 0;
+    schedErrorClearCount = 0;
     
     lcdState = FAULT_STATE_NORMAL;
     ledState = FAULT_STATE_NORMAL;
     gmslState = FAULT_STATE_NORMAL;
+    schedState = FAULT_STATE_NORMAL;
+    schedReportCount = 0;
+    for (int i = 0; i < FAULT_INPUT_MAX; ++i) {
+        s_os_bits[i] = 0;
+        s_os_vote[i] = false;
+    }
+    s_os_fill = 0;
+    fault_agg_init();
+#if !defined(__AVR__)
+    sc_port_sim_input_source(sim_fault_pins);
+#endif
+
+    // 리셋 전에 열려 있던 latched 구간은 여기서 닫음 (통계 자체는 유지)
+    for (int ch = 0; ch < FAULT_CH_MAX; ++ch) {
+        fault_stat_acc_t *acc = &s_fstat[ch];
+        if (!acc->pub.latched) continue;
+        uint32_t dur = g_tick_ms - acc->latch_start;
+        acc->pub.time_latched_ms += dur;
+        if (dur > acc->pub.longest_ms) acc->pub.longest_ms = dur;
+        acc->pub.latched = 0;
+    }
+}
+
+/**
+ * @brief 채널별 통계 스냅샷 (진행 중인 latched 구간을 시간 항목에 반영)
+ */
+void fault_input_get_stats(fault_stats_t* out) {
+    if (!out) return;
+    uint32_t now = g_tick_ms;
+    out->tick_ms = now;
+    for (int ch = 0; ch < FAULT_CH_MAX; ++ch) {
+        const fault_stat_acc_t *acc = &s_fstat[ch];
+        out->ch[ch] = acc->pub;
+        if (acc->pub.latched) {
+            uint32_t dur = now - acc->latch_start;
+            out->ch[ch].time_latched_ms += dur;
+            if (dur > out->ch[ch].longest_ms) out->ch[ch].longest_ms = dur;
+        }
+    }
+}
+
+void fault_input_reset_stats(void) {
+    for (int ch = 0; ch < FAULT_CH_MAX; ++ch) {
+        uint8_t latched = s_fstat[ch].pub.latched;
+        s_fstat[ch] = (fault_stat_acc_t){ 0 };
+        s_fstat[ch].pub.latched = latched;   // 진행 중 구간은 지금부터 다시 측정
+        s_fstat[ch].latch_start = g_tick_ms;
+    }
 }
 
 /**
@@ -251,4 +445,8 @@ bool is_led_fault_latched(void) {
 
 bool is_gmsl_fault_latched(void) {
     return (gmslState == FAULT_STATE_ERROR_LATCHED);
-}
\ No newline at end of file
+}
+
+bool is_sched_fault_latched(void) {
+    return (schedState == FAULT_STATE_ERROR_LATCHED);
+}
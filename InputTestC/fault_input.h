@@ -2,7 +2,11 @@
  * @file fault_input.h
  * @brief Fault Input Detection Module
  * @details 3회 연속 에러 감지 시 latched, 3회 연속 정상 시 cleared
- *          동일 시점 스냅샷 기반 안전한 입력 처리
+ *          동일 시점 스냅샷 기반 안전한 입력 처리 — 입력은 틱 ISR 이 래치한
+ *          공용 스냅샷(Schedular/core/sched_input.h)에서 읽으므로 다른 모듈과도 같은 시점
+ *          오버샘플링: fault_input_sample_task() 가 디바운스 주기 안에서 서브샘플을 채널별
+ *          비트열로 모으고, 디바운서는 최근 N 개의 다수결(popcount) 1개를 입력으로 받는다
+ *          → 서브샘플 1개짜리 글리치는 카운터를 리셋하지 못함
  */
 
 #ifndef FAULT_INPUT_H
@@ -15,6 +19,77 @@
 extern "C" {
 #endif
 
+/* ===== Fault 채널 ===== */
+
+/**
+ * @brief Fault 채널 식별자 (트레이스/통계 공통)
+ */
+typedef enum {
+    FAULT_CH_LCD = 0,
+    FAULT_CH_LED,
+    FAULT_CH_GMSL,
+    FAULT_CH_SCHED,     ///< 스케줄러 데드라인 (supervisor 보고)
+    FAULT_CH_MAX
+} fault_channel_t;
+
+/* ===== Fault 입력 핀 (sched_input 스냅샷 비트, Active High) ===== */
+#ifndef FAULT_PIN_LCD
+#define FAULT_PIN_LCD   6
+#endif
+#ifndef FAULT_PIN_LED
+#define FAULT_PIN_LED   7
+#endif
+#ifndef FAULT_PIN_GMSL
+#define FAULT_PIN_GMSL  8
+#endif
+
+/* ===== 오버샘플링 (채널별 서브샘플 수, 1 = 기존 단일 샘플) ===== */
+/* 서브샘플 주기는 sch_tasks.def 의 fault_sample (10ms), 디바운스 주기는 fault_input (100ms)
+ * → N ≤ 디바운스 주기 / 서브샘플 주기. 짝수 N 의 동률은 직전 판정 유지. 최대 32 */
+#ifndef FAULT_OS_N_LCD
+#define FAULT_OS_N_LCD   10
+#endif
+#ifndef FAULT_OS_N_LED
+#define FAULT_OS_N_LED   10
+#endif
+#ifndef FAULT_OS_N_GMSL
+#define FAULT_OS_N_GMSL  10
+#endif
+
+/* ===== Fault 통계 ===== */
+
+#ifndef FAULT_CHATTER_WINDOW
+#define FAULT_CHATTER_WINDOW   16   ///< 채터 판정 창 (최근 샘플 수, 최대 32)
+#endif
+
+#ifndef FAULT_CHATTER_TOGGLES
+#define FAULT_CHATTER_TOGGLES  4    ///< 창 안 원시 입력 토글 수가 이 이상이면 채터링
+#endif
+
+/**
+ * @brief 채널별 누적 통계 (init_fault_detection 으로 지워지지 않음)
+ */
+typedef struct {
+    uint32_t samples;           ///< 디바운스 입력 샘플 수
+    uint32_t raw_faults;        ///< 원시 fault 샘플 수 (samples 대비 duty)
+    uint32_t toggles;           ///< 원시 입력 토글 누적
+    uint32_t os_rejected;       ///< 다수결에서 버려진 소수 서브샘플 수 (글리치)
+    uint32_t latch_events;      ///< latched 전환 횟수
+    uint32_t time_latched_ms;   ///< latched 상태 누적 시간 (진행 중 구간 포함)
+    uint32_t longest_ms;        ///< 가장 긴 latched 구간 (진행 중 구간 포함)
+    uint16_t chatter_events;    ///< 채터링 진입 횟수
+    uint8_t  chattering;        ///< 현재 채터링 중
+    uint8_t  latched;           ///< 현재 latched
+} fault_ch_stats_t;
+
+/**
+ * @brief 전체 채널 통계 스냅샷
+ */
+typedef struct {
+    uint32_t         tick_ms;   ///< 스냅샷 시각
+    fault_ch_stats_t ch[FAULT_CH_MAX];
+} fault_stats_t;
+
 /* ===== Public API Functions ===== */
 
 /**
@@ -32,6 +107,13 @@ void init_fault_detection(void); // ! TODO :  시스템 시작 시 1회 호출 
  */
 void fault_input_10ms_task(void); 
 
+/**
+ * @brief 서브샘플 수집 (sch_tasks.def fault_sample — 디바운스보다 빠른 주기)
+ * @details 틱 스냅샷에서 채널별 비트 1개씩을 비트열에 밀어 넣기만 한다 (분기/출력 없음).
+ *          다음 fault_input_10ms_task() 가 그 사이 모인 서브샘플로 다수결한다.
+ */
+void fault_input_sample_task(void);
+
 /**
  * @brief LCD Fault 상태 조회
  * @return true: Fault latched, false: Normal
@@ -50,6 +132,30 @@ bool is_led_fault_latched(void);
  */
 bool is_gmsl_fault_latched(void);
 
+/**
+ * @brief 스케줄러 데드라인 결과 보고 (supervisor 에서 호출)
+ * @param missed true: 예산 초과, false: 정상 종료
+ * @details 입력 채널과 동일한 디바운스 — 3회 연속 초과 시 latched, 3회 연속 정상 시 cleared
+ */
+void fault_input_report_deadline(bool missed);
+
+/**
+ * @brief 스케줄러(데드라인) Fault 상태 조회
+ * @return true: Fault latched, false: Normal
+ */
+bool is_sched_fault_latched(void);
+
+/**
+ * @brief 채널별 통계 스냅샷 조회
+ * @param out 결과 저장 위치 (NULL 이면 무시)
+ */
+void fault_input_get_stats(fault_stats_t* out);
+
+/**
+ * @brief 채널별 통계 초기화
+ */
+void fault_input_reset_stats(void);
+
 /**
  * @brief 테스트 카운터 리셋 (테스트용)
  * @note 테스트 시작 전 호출하여 더미 데이터를 처음부터 재생
@@ -68,6 +174,8 @@ extern volatile uint8_t gmslErrorCount;
 extern volatile uint8_t lcdErrorClearCount;
 extern volatile uint8_t ledErrorClearCount;
 extern volatile uint8_t gmslErrorClearCount;
+extern volatile uint8_t schedErrorCount;
+extern volatile uint8_t schedErrorClearCount;
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,244 @@
+/**
+ * @file fault_log.c
+ * @brief 비휘발 Fault 이력 구현
+ */
+
+#include "fault_log.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__AVR__)
+#include <avr/eeprom.h>
+#endif
+
+#if (FLOG_PENDING & (FLOG_PENDING - 1)) != 0
+#error "FLOG_PENDING must be a power of two"
+#endif
+
+/* 외부 스케줄러 변수 */
+extern volatile uint32_t g_tick_ms;
+
+/* ===== 레코드 슬롯 형식 (8 bytes, little endian)
+ * [0..1] seq  [2] ev<<4 | ch  [3] crc8  [4..7] tick
+ * 지워진 슬롯(0xFF)은 ev=0xF 이므로 CRC 와 무관하게 무효
+ */
+#define FLOG_REC_BYTES  8
+#define FLOG_SLOTS      (FLOG_STORE_BYTES / FLOG_REC_BYTES)
+
+typedef struct {
+  uint8_t  ch;
+  uint8_t  ev;
+  uint32_t tick;
+} flog_pending_t;
+
+typedef struct {
+  uint16_t slot;
+  uint16_t seq;
+} flog_idx_t;
+
+/* ===== 전역 변수 ===== */
+static flog_pending_t s_pend[FLOG_PENDING];
+static volatile uint8_t s_pend_head = 0;   // ISR 가 씀
+static volatile uint8_t s_pend_tail = 0;   // idle 이 씀
+
+static flog_idx_t s_idx[FAULT_CH_MAX][FLOG_INDEX_DEPTH];  // 최신 순
+static uint8_t s_idx_n[FAULT_CH_MAX];
+
+static flog_stats_t s_stats;
+static flog_clock_fn_t s_clock = 0;   // NULL = g_tick_ms
+
+/* ===== 저장소 포트 ===== */
+
+#if defined(__AVR__)
+static void flog_port_open(void) {}
+
+static void flog_port_read(uint16_t addr, uint8_t* buf, uint8_t len) {
+  eeprom_read_block(buf, (const void*)(uintptr_t)addr, len);
+}
+
+static void flog_port_write(uint16_t addr, const uint8_t* buf, uint8_t len) {
+  eeprom_update_block(buf, (void*)(uintptr_t)addr, len);
+}
+#else
+/* 호스트: 파일을 EEPROM 으로 간주 (없으면 0xFF 로 채워 생성) */
+static FILE* s_fp = NULL;
+
+static void flog_port_open(void) {
+  if (s_fp) return;
+  s_fp = fopen(FLOG_HOST_FILE, "r+b");
+  if (!s_fp) {
+    s_fp = fopen(FLOG_HOST_FILE, "w+b");
+    if (!s_fp) return;
+    for (int i = 0; i < FLOG_STORE_BYTES; ++i) fputc(0xFF, s_fp);
+    fflush(s_fp);
+  }
+}
+
+static void flog_port_read(uint16_t addr, uint8_t* buf, uint8_t len) {
+  memset(buf, 0xFF, len);
+  if (!s_fp || fseek(s_fp, addr, SEEK_SET) != 0) return;
+  if (fread(buf, 1, len, s_fp) != len) memset(buf, 0xFF, len);
+}
+
+static void flog_port_write(uint16_t addr, const uint8_t* buf, uint8_t len) {
+  if (!s_fp || fseek(s_fp, addr, SEEK_SET) != 0) return;
+  fwrite(buf, 1, len, s_fp);
+  fflush(s_fp);
+}
+#endif
+
+/* ===== 레코드 인코딩 ===== */
+
+static uint8_t crc8(const uint8_t* p, uint8_t len) {
+  uint8_t crc = 0;
+  while (len--) {
+    crc ^= *p++;
+    for (uint8_t b = 0; b < 8; ++b) crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+static uint8_t rec_crc(const uint8_t* raw) {
+  uint8_t tmp[FLOG_REC_BYTES - 1] = { raw[0], raw[1], raw[2], raw[4], raw[5], raw[6], raw[7] };
+  return crc8(tmp, sizeof(tmp));
+}
+
+static void rec_encode(uint8_t* raw, uint16_t seq, uint8_t ch, uint8_t ev, uint32_t tick) {
+  raw[0] = (uint8_t)seq;
+  raw[1] = (uint8_t)(seq >> 8);
+  raw[2] = (uint8_t)((ev << 4) | (ch & 0x0F));
+  raw[4] = (uint8_t)tick;
+  raw[5] = (uint8_t)(tick >> 8);
+  raw[6] = (uint8_t)(tick >> 16);
+  raw[7] = (uint8_t)(tick >> 24);
+  raw[3] = rec_crc(raw);
+}
+
+/* 슬롯 읽기 — 유효하면 true */
+static bool slot_read(uint16_t slot, flog_rec_t* out) {
+  uint8_t raw[FLOG_REC_BYTES];
+  flog_port_read((uint16_t)(slot * FLOG_REC_BYTES), raw, FLOG_REC_BYTES);
+  uint8_t ev = raw[2] >> 4;
+  if (ev == 0 || ev == 0x0F || raw[3] != rec_crc(raw)) return false;
+  out->seq = (uint16_t)(raw[0] | (raw[1] << 8));
+  out->ch = raw[2] & 0x0F;
+  out->ev = ev;
+  out->tick = (uint32_t)raw[4] | ((uint32_t)raw[5] << 8) | ((uint32_t)raw[6] << 16) | ((uint32_t)raw[7] << 24);
+  return true;
+}
+
+/* 채널 인덱스 맨 앞(최신)에 삽입 */
+static void idx_push_front(uint8_t ch, uint16_t slot, uint16_t seq) {
+  if (ch >= FAULT_CH_MAX) return;
+  memmove(&s_idx[ch][1], &s_idx[ch][0], sizeof(flog_idx_t) * (FLOG_INDEX_DEPTH - 1));
+  s_idx[ch][0] = (flog_idx_t){ slot, seq };
+  if (s_idx_n[ch] < FLOG_INDEX_DEPTH) s_idx_n[ch]++;
+}
+
+/* 채널 인덱스 맨 뒤(과거)에 추가 — 복구 시 최신부터 역방향으로 채움 */
+static void idx_push_back(uint8_t ch, uint16_t slot, uint16_t seq) {
+  if (ch >= FAULT_CH_MAX || s_idx_n[ch] >= FLOG_INDEX_DEPTH) return;
+  s_idx[ch][s_idx_n[ch]++] = (flog_idx_t){ slot, seq };
+}
+
+/* ===== Public API ===== */
+
+int fault_log_init(void) {
+  flog_port_open();
+  s_pend_head = s_pend_tail = 0;
+  memset(s_idx_n, 0, sizeof(s_idx_n));
+  s_stats = (flog_stats_t){ 0 };
+
+  /* 1) 최신 레코드 찾기: 다음 슬롯이 seq+1 로 이어지지 않는 유효 레코드 */
+  int32_t newest = -1;
+  uint16_t newest_seq = 0;
+  for (uint16_t i = 0; i < FLOG_SLOTS; ++i) {
+    flog_rec_t r, nx;
+    if (!slot_read(i, &r)) {
+      uint8_t raw[FLOG_REC_BYTES];
+      flog_port_read((uint16_t)(i * FLOG_REC_BYTES), raw, FLOG_REC_BYTES);
+      if ((raw[2] >> 4) != 0x0F) s_stats.torn++;   // 지워진 슬롯이 아닌 무효 = 끊긴 쓰기
+      continue;
+    }
+    bool linked = slot_read((uint16_t)((i + 1) % FLOG_SLOTS), &nx) && nx.seq == (uint16_t)(r.seq + 1);
+    if (linked) continue;
+    if (newest < 0 || (int16_t)(r.seq - newest_seq) > 0) {
+      newest = i;
+      newest_seq = r.seq;
+    }
+  }
+
+  /* 2) 최신부터 역방향으로 연속 시퀀스를 따라가며 개수/인덱스 복구 */
+  if (newest >= 0) {
+    uint16_t slot = (uint16_t)newest;
+    uint16_t expect = newest_seq;
+    flog_rec_t r;
+    while (s_stats.count < FLOG_SLOTS && slot_read(slot, &r) && r.seq == expect) {
+      idx_push_back(r.ch, slot, r.seq);
+      s_stats.count++;
+      expect--;
+      slot = (uint16_t)((slot + FLOG_SLOTS - 1) % FLOG_SLOTS);
+    }
+    s_stats.head = (uint16_t)((newest + 1) % FLOG_SLOTS);
+    s_stats.next_seq = (uint16_t)(newest_seq + 1);
+  }
+
+  printf("[FLOG] recovered %u records [next_seq=%u, torn=%u]\n",
+         s_stats.count, s_stats.next_seq, s_stats.torn);
+
+  fault_log_append(FLOG_CH_NONE, FLOG_EV_BOOT);
+  return s_stats.count;
+}
+
+void fault_log_set_clock(flog_clock_fn_t fn) {
+  s_clock = fn;
+}
+
+int fault_log_append(uint8_t ch, uint8_t ev) {
+  uint8_t head = s_pend_head;
+  if ((uint8_t)(head - s_pend_tail) >= FLOG_PENDING) {
+    s_stats.dropped++;
+    return -1;
+  }
+  s_pend[head & (FLOG_PENDING - 1)] = (flog_pending_t){ ch, ev, s_clock ? s_clock() : g_tick_ms };
+  s_pend_head = (uint8_t)(head + 1);
+  return 0;
+}
+
+uint8_t fault_log_commit(void) {
+  uint8_t n = 0;
+  while (s_pend_tail != s_pend_head) {
+    const flog_pending_t* p = &s_pend[s_pend_tail & (FLOG_PENDING - 1)];
+    uint8_t raw[FLOG_REC_BYTES];
+    uint16_t slot = s_stats.head;
+    uint16_t seq = s_stats.next_seq;
+
+    rec_encode(raw, seq, p->ch, p->ev, p->tick);
+    flog_port_write((uint16_t)(slot * FLOG_REC_BYTES), raw, FLOG_REC_BYTES);
+    idx_push_front(p->ch, slot, seq);
+
+    s_stats.head = (uint16_t)((slot + 1) % FLOG_SLOTS);
+    s_stats.next_seq = (uint16_t)(seq + 1);
+    if (s_stats.count < FLOG_SLOTS) s_stats.count++;
+    s_stats.committed++;
+    s_pend_tail = (uint8_t)(s_pend_tail + 1);
+    n++;
+  }
+  return n;
+}
+
+uint8_t fault_log_last(uint8_t ch, flog_rec_t* out, uint8_t n) {
+  if (!out || ch >= FAULT_CH_MAX) return 0;
+  if (n > s_idx_n[ch]) n = s_idx_n[ch];
+  uint8_t k = 0;
+  for (; k < n; ++k) {
+    // 링이 한 바퀴 돌아 덮어쓴 슬롯은 seq 불일치 → 이후 항목도 더 오래됐으므로 종료
+    if (!slot_read(s_idx[ch][k].slot, &out[k]) || out[k].seq != s_idx[ch][k].seq) break;
+  }
+  return k;
+}
+
+void fault_log_get_stats(flog_stats_t* out) {
+  if (!out) return;
+  *out = s_stats;
+}
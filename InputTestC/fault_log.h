@@ -0,0 +1,114 @@
+/**
+ * @file fault_log.h
+ * @brief 비휘발 Fault 이력 (append-only 원형 로그, 웨어 레벨링)
+ * @details - 저장 영역 전체를 8바이트 레코드 슬롯 링으로 사용 → 모든 슬롯이 순서대로 닳음
+ *          - latch/clear 는 ISR 에서 RAM 대기열에만 적재, 기록은 idle 에서 fault_log_commit()
+ *          - 부팅 시 전체 스캔으로 CRC 가 맞는 마지막 연속 시퀀스를 찾아 헤드 복구
+ *            (쓰다 끊긴 레코드는 CRC 불일치 → 빈 슬롯으로 취급, 다음 기록이 덮어씀)
+ *          - 채널별 최근 FLOG_INDEX_DEPTH 개 슬롯 인덱스를 RAM 에 유지 → 조회 시 스캔 없음
+ *          - AVR: 내장 EEPROM, 호스트: FLOG_HOST_FILE 파일
+ */
+#ifndef FAULT_LOG_H
+#define FAULT_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fault_input.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef FLOG_STORE_BYTES
+#define FLOG_STORE_BYTES   1024   ///< 로그 영역 크기 (ATmega328P EEPROM 전체)
+#endif
+
+#ifndef FLOG_PENDING
+#define FLOG_PENDING       8      ///< 커밋 대기 레코드 수 (2의 거듭제곱)
+#endif
+
+#define FLOG_INDEX_DEPTH   4      ///< 채널별 RAM 인덱스 깊이 (fault_log_last 최대 n)
+
+#ifndef FLOG_HOST_FILE
+#define FLOG_HOST_FILE     "fault_log.bin"
+#endif
+
+/* ===== 레코드 종류 ===== */
+#define FLOG_EV_LATCH      1
+#define FLOG_EV_CLEAR      2
+#define FLOG_EV_BOOT       3      ///< 부팅 마커 (ch = FLOG_CH_NONE)
+#define FLOG_EV_SYNC       4      ///< 시각축 스텝 마커 (ch = FLOG_CH_NONE) — 이후 레코드는 새 시각축
+
+#define FLOG_CH_NONE       0x0F
+
+/**
+ * @brief 이력 레코드 (조회 결과)
+ */
+typedef struct {
+  uint16_t seq;       ///< 기록 순번 (래핑)
+  uint8_t  ch;        ///< fault_channel_t 또는 FLOG_CH_NONE
+  uint8_t  ev;        ///< FLOG_EV_xxx
+  uint32_t tick;      ///< 기록 시각 (fault_log_set_clock, 기본 g_tick_ms — 부팅 기준)
+} flog_rec_t;
+
+/**
+ * @brief 로그 상태 (디버깅/모니터링)
+ */
+typedef struct {
+  uint16_t count;     ///< 유효 레코드 수
+  uint16_t next_seq;  ///< 다음 기록 순번
+  uint16_t head;      ///< 다음 기록 슬롯
+  uint16_t torn;      ///< 부팅 스캔 시 발견한 CRC 불일치 슬롯 수
+  uint16_t dropped;   ///< 대기열 가득 참으로 버린 레코드 수
+  uint16_t committed; ///< 이번 부팅에서 기록한 레코드 수
+} flog_stats_t;
+
+/**
+ * @brief 기록 시각 함수 (ms) — ISR 에서도 불림
+ */
+typedef uint32_t (*flog_clock_fn_t)(void);
+
+/**
+ * @brief 기록 시각 출처 지정 (기본 g_tick_ms, 적재 시점에 스탬프)
+ * @param fn 예: 보드 간 동기 시각 (sc_sync_stamp() 래퍼), NULL = g_tick_ms
+ * @note  동기 시각축이 스텝하면 FLOG_EV_SYNC 마커를 적재해 이전 레코드와 구분
+ */
+void fault_log_set_clock(flog_clock_fn_t fn);
+
+/**
+ * @brief 로그 복구 + 인덱스 재구성 + 부팅 마커 적재 (부팅 시 1회)
+ * @return 복구된 유효 레코드 수
+ */
+int fault_log_init(void);
+
+/**
+ * @brief 레코드 적재 (ISR-safe, RAM 만 사용)
+ * @return 0: 성공, -1: 대기열 가득 참
+ */
+int fault_log_append(uint8_t ch, uint8_t ev);
+
+/**
+ * @brief 대기 레코드를 저장 영역에 기록 (idle 에서 호출, 틱에서 호출 금지)
+ * @return 기록한 레코드 수
+ */
+uint8_t fault_log_commit(void);
+
+/**
+ * @brief 채널별 최근 레코드 조회 (최신 순)
+ * @param ch  fault_channel_t
+ * @param out 결과 버퍼
+ * @param n   최대 개수 (FLOG_INDEX_DEPTH 이하로 잘림)
+ * @return 채운 개수
+ */
+uint8_t fault_log_last(uint8_t ch, flog_rec_t* out, uint8_t n);
+
+/**
+ * @brief 로그 상태 조회
+ */
+void fault_log_get_stats(flog_stats_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FAULT_LOG_H
@@ -0,0 +1,281 @@
+/**
+ * @file main.c
+ * @brief 호스트 테스트 메인 (1ms ISR 시뮬레이션 루프)
+ * @details 워치독 만료 시 supervisor 리셋 훅이 longjmp 로 부팅 지점에 복귀하여
+ *          하드웨어 리셋을 시뮬레이션한다.
+ *          틱은 sch_idle() 의 슬립이 발생시킨다. 기본은 가상 시간(대기 없음),
+ *          --realtime 이면 실제 시간으로 진행하며 틱 사이 스레드를 재운다.
+ *          --soak [wraps] 는 시간 압축 소크: g_tick_ms 를 래핑 직전에서 시작하고 빈 틱을
+ *          건너뛰어 32비트 틱 래핑을 wraps 회 통과하며 타이밍 불변식을 검사한다.
+ *          --overload 는 실시간으로 틱마다 ISR 안에서 틱 주기를 넘기는 1회성 태스크를 돌리고
+ *          (무해한 동적 주기 슬롯 1개와 함께) 과부하 감지기가 최고 단계까지 오르는지 검사한다.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <setjmp.h>
+#include <time.h>
+#include "sch.h"
+#include "fault_input.h"
+#include "supervisor.h"
+#include "trace.h"
+#include "fault_log.h"
+#include "sched_port.h"
+#include "sched_time.h"
+
+#define SIM_TOTAL_MS 20000   // 20초 시뮬레이션
+#define SIM_TRACE_FILE "trace.txt"  // tools/trace2json 입력
+
+/* 소크 (--soak) */
+#define SOAK_ORIGIN     (0u - 15000u)   // 부팅 15초 뒤 첫 래핑 (부팅 윈도우 10초 이후)
+#define SOAK_WRAPS      2               // 기본 래핑 횟수 (1회 = 2^32 ms ≈ 49.7일)
+#define SOAK_STEP_MAX   SUP_WDT_WINDOW_MS  // 루프 1회 최대 진행 (워치독 윈도우에서 끊김)
+#ifdef _WIN32
+#define SOAK_NULL_DEV   "NUL"
+#else
+#define SOAK_NULL_DEV   "/dev/null"
+#endif
+
+/* 과부하 검사 (--overload) */
+#define OVL_HOG_US      3000            // 틱마다 ISR 안에서 점유 (부팅 모드 틱 1ms 의 3배)
+#define OVL_RUN_MS      300             // 부하 구간 (g_tick_ms 기준)
+
+static jmp_buf s_reset_point;
+static int cnt = 0;          // 리셋과 무관한 전체 진행 틱
+
+/* 소크 진행 상태 (리셋과 무관하게 누적) */
+typedef struct {
+    uint64_t sim_ms;         // 전체 시뮬레이션 시간
+    uint64_t loops;          // 실제로 발생한 틱 수
+    uint32_t prev_tick;      // 직전 루프의 g_tick_ms
+    uint32_t wraps;          // g_tick_ms 래핑 횟수
+    uint32_t violations;
+    char     first[160];     // 첫 위반 내용
+} soak_t;
+
+static soak_t s_soak;
+
+static FILE* s_trace_fp = NULL;
+
+static bool s_ovl_hog;
+
+/* 1회성 부하: 틱 주기를 넘겨 점유한 뒤 다음 틱에 다시 예약 */
+static void ovl_hog(void) {
+    sc_time_t t0 = sc_time_us();
+    while (sc_time_us() - t0 < OVL_HOG_US) {}
+    if (s_ovl_hog) sch_post_oneshot(ovl_hog, 1);
+}
+
+/* 무해한 동적 주기 슬롯 — 릴리즈마다 코어가 솎음 판정 */
+static void ovl_slot(void* ctx) {
+    (void)ctx;
+}
+
+/*
+ * 과부하 검사: 동적 주기 슬롯이 있어도 틱 초과가 이어지면 감지기가 SHED 까지 올라가야 한다
+ * (코어가 슬롯 릴리즈마다 지연 0 을 따로 보고하면 연속 카운트가 끊겨 단계가 오르지 않음)
+ */
+static int overload_run(void) {
+    uint8_t dummy = 0;
+    if (sch_post_ctx(ovl_slot, &dummy, sizeof(dummy), 1, 1) < 0) return 2;
+    s_ovl_hog = true;
+    sch_post_oneshot(ovl_hog, 1);
+
+    uint32_t start = g_tick_ms;
+    while (g_tick_ms - start < OVL_RUN_MS) {
+        sch_idle();
+        run_tasks();
+        fault_log_commit();
+    }
+    s_ovl_hog = false;
+
+    sch_stats_t sst;
+    sch_get_stats(&sst);
+    bool pass = sst.load_level_max == 2 && sst.load_enters >= 1;
+    fprintf(stderr, "[OVERLOAD] overruns=%u late_max=%ums level=%u max=%u enters=%u shed=%lu\n",
+            sst.tick_overruns, sst.tick_late_max_ms, sst.load_level, sst.load_level_max,
+            sst.load_enters, (unsigned long)sst.shed);
+    fprintf(stderr, "[OVERLOAD] %s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+
+static void trace_putc_file(char c) {
+    fputc(c, s_trace_fp);
+}
+
+static void sim_wdt_reset(void) {
+    longjmp(s_reset_point, 1);
+}
+
+static void soak_violation(const char* what, uint32_t a, uint32_t b) {
+    if (s_soak.violations++ == 0) {
+        snprintf(s_soak.first, sizeof(s_soak.first), "%s (%lu vs %lu) at tick=%lu sim_ms=%llu",
+                 what, (unsigned long)a, (unsigned long)b, (unsigned long)g_tick_ms,
+                 (unsigned long long)s_soak.sim_ms);
+    }
+}
+
+/*
+ * 루프 1회 불변식
+ * - 틱은 앞으로만, 한 번에 SOAK_STEP_MAX 이하 (건너뛰기가 워치독 윈도우를 넘지 않음)
+ * - 64비트 us 시간축과 32비트 틱이 원점 차이만큼 일치 (래핑 후에도)
+ */
+static void soak_check_step(void) {
+    uint32_t now = g_tick_ms;
+    uint32_t d = now - s_soak.prev_tick;
+    if (d == 0 || d > SOAK_STEP_MAX) soak_violation("tick step", d, SOAK_STEP_MAX);
+    if (now < s_soak.prev_tick) s_soak.wraps++;
+    s_soak.prev_tick = now;
+    s_soak.sim_ms += d;
+    s_soak.loops++;
+
+    uint32_t up = (uint32_t)(sc_time_us() / 1000u);
+    if (up != now - SOAK_ORIGIN) soak_violation("timebase", up, now - SOAK_ORIGIN);
+}
+
+/*
+ * 종료 시 불변식
+ * - 워치독 윈도우 누락/리셋 없음 (critical 정적 태스크가 래핑을 넘어 매 윈도우 실행)
+ * - 정적 태스크 실행 횟수 = 부팅 후 경과로 계산한 릴리즈 수 (fault_input: offset 2000, 주기 100)
+ * - 동적 슬롯 등록 실패 없음
+ */
+static void soak_check_end(void) {
+    sup_stats_t st;
+    sup_get_stats(&st);
+    if (st.window_miss) soak_violation("window_miss", st.window_miss, 0);
+    if (st.wdt_resets)  soak_violation("wdt_resets", st.wdt_resets, 0);
+
+    fault_stats_t fst;
+    fault_input_get_stats(&fst);
+    uint64_t up = sc_time_us() / 1000u;
+    uint64_t expect = (up >= 2000u) ? (up - 2000u) / 100u + 1u : 0u;
+    if (!st.wdt_resets && fst.ch[FAULT_CH_LCD].samples != expect)
+        soak_violation("static releases", fst.ch[FAULT_CH_LCD].samples, (uint32_t)expect);
+
+    sch_stats_t sst;
+    sch_get_stats(&sst);
+    if (sst.alloc_fail) soak_violation("alloc_fail", sst.alloc_fail, 0);
+    if (sst.flag_lost)  soak_violation("flag_lost", sst.flag_lost, 0);
+    if (sst.shed)       soak_violation("shed", sst.shed, 0);
+}
+
+static int soak_report(double wall_s) {
+    double sim_s = (double)s_soak.sim_ms / 1000.0;
+    fprintf(stderr, "[SOAK] origin=0x%08lx wraps=%lu sim=%.0fs (%.1f days) ticks=%llu wall=%.2fs speedup=x%.0f\n",
+            (unsigned long)SOAK_ORIGIN, (unsigned long)s_soak.wraps, sim_s, sim_s / 86400.0,
+            (unsigned long long)s_soak.loops, wall_s, wall_s > 0 ? sim_s / wall_s : 0.0);
+    if (s_soak.violations) {
+        fprintf(stderr, "[SOAK] FAIL violations=%lu first: %s\n",
+                (unsigned long)s_soak.violations, s_soak.first);
+        return 1;
+    }
+    fprintf(stderr, "[SOAK] PASS\n");
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    bool isExit = false;
+    bool realtime = (argc > 1 && strcmp(argv[1], "--realtime") == 0);
+    bool soak = (argc > 1 && strcmp(argv[1], "--soak") == 0);
+    bool overload = (argc > 1 && strcmp(argv[1], "--overload") == 0);
+    uint32_t soak_wraps = (soak && argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : SOAK_WRAPS;
+    static clock_t soak_t0;
+
+    if (overload) {
+        realtime = true;
+        if (!freopen(SOAK_NULL_DEV, "w", stdout)) return 2;   // 보고서만 stderr 로
+    }
+    if (soak && !soak_t0) {
+        // 태스크 출력(래치/복구 로그)은 버리고 보고서만 stderr 로
+        if (!freopen(SOAK_NULL_DEV, "w", stdout)) return 2;
+        sch_sim_set_origin(SOAK_ORIGIN);
+        soak_t0 = clock();
+    }
+
+    if (setjmp(s_reset_point)) {
+        printf("[BOOT] Restart after watchdog reset\n");
+    }
+
+    sup_set_reset_hook(sim_wdt_reset);
+    fault_log_init();   // 이전 부팅의 이력 복구
+    init_fault_detection();
+    reset_dummy_counter();
+    init_task();
+    sc_port_sim_realtime(realtime);
+
+    if (overload) return overload_run();
+
+    if (soak) {
+        sch_sim_fast_forward(true);
+        s_soak.prev_tick = g_tick_ms;   // 리셋 후 재부팅도 원점에서 다시
+        while (s_soak.wraps < soak_wraps || s_soak.sim_ms < SIM_TOTAL_MS) {
+            sch_idle();
+            run_tasks();
+            fault_log_commit();
+            soak_check_step();
+        }
+        soak_check_end();
+        return soak_report((double)(clock() - soak_t0) / CLOCKS_PER_SEC);
+    }
+
+    while (!isExit) {
+        uint8_t step = sch_tick_period_ms();  // 이번 틱이 진행시킬 시간
+        sch_idle();   // 다음 틱까지 슬립 → 틱 (부팅 1ms → 일반 모드 10ms) 에서 test_isr()
+        run_tasks();  // 스케줄러 실행
+        fault_log_commit();  // idle: 대기 중인 이력 기록
+        cnt += step;
+        if (cnt > SIM_TOTAL_MS) {
+            isExit = true;
+        }
+    }
+
+    sup_stats_t st;
+    sup_get_stats(&st);
+    printf("[SUP] window_miss=%u wdt_resets=%u\n", st.window_miss, st.wdt_resets);
+
+    sch_stats_t sst;
+    sch_get_stats(&sst);
+    printf("[LOAD] level=%u max=%u overruns=%u late_max=%ums shed=%lu missed=%lu enters=%u recovers=%u flag_lost=%u\n",
+           sst.load_level, sst.load_level_max, sst.tick_overruns, sst.tick_late_max_ms,
+           (unsigned long)sst.shed, (unsigned long)sst.missed, sst.load_enters, sst.load_recovers,
+           sst.flag_lost);
+
+    if (realtime) {
+        sch_idle_stats_t ist;
+        sch_get_idle_stats(&ist);
+        printf("[IDLE] util=%u.%u%% peak=%u.%u%% slack_min=%luus sleeps light=%lu deep=%lu\n",
+               ist.util_permille / 10, ist.util_permille % 10, ist.util_peak / 10, ist.util_peak % 10,
+               (unsigned long)ist.slack_min_us, (unsigned long)ist.sleeps_light,
+               (unsigned long)ist.sleeps_deep);
+    }
+
+    static const char* const ch_names[FAULT_CH_MAX] = { "LCD", "LED", "GMSL", "SCHED" };
+    fault_stats_t fst;
+    fault_input_get_stats(&fst);
+    for (int ch = 0; ch < FAULT_CH_MAX; ++ch) {
+        const fault_ch_stats_t* c = &fst.ch[ch];
+        printf("[FSTAT] %-5s samples=%lu raw=%lu toggles=%lu latch=%lu latched_ms=%lu longest_ms=%lu chatter=%u glitch=%lu%s\n",
+               ch_names[ch], (unsigned long)c->samples, (unsigned long)c->raw_faults,
+               (unsigned long)c->toggles, (unsigned long)c->latch_events,
+               (unsigned long)c->time_latched_ms, (unsigned long)c->longest_ms,
+               c->chatter_events, (unsigned long)c->os_rejected, c->chattering ? " (chattering)" : "");
+    }
+    for (int ch = 0; ch < FAULT_CH_MAX; ++ch) {
+        flog_rec_t recs[FLOG_INDEX_DEPTH];
+        uint8_t n = fault_log_last((uint8_t)ch, recs, FLOG_INDEX_DEPTH);
+        for (uint8_t k = 0; k < n; ++k) {
+            printf("[FLOG] %s #%u %s [tick=%lu]\n", ch_names[ch], recs[k].seq,
+                   (recs[k].ev == FLOG_EV_LATCH) ? "latched" : "cleared", (unsigned long)recs[k].tick);
+        }
+    }
+
+    s_trace_fp = fopen(SIM_TRACE_FILE, "w");
+    if (s_trace_fp) {
+        trace_dump(trace_putc_file);
+        fclose(s_trace_fp);
+        printf("[TRACE] dumped to %s\n", SIM_TRACE_FILE);
+    }
+    return 0;
+}
@@ -6,16 +6,13 @@
 #include <stdio.h>
 #include "sch.h"
 #include "fault_input.h"
-
-/* ===== 내부 타입 정의 ===== */
-typedef struct {
-  task_fn_t   fn;
-  task_mode_t mode;
-  uint8_t     active;
-  uint32_t    due_ms;
-  uint32_t    period_ms;
-} task_slot_t;
-
+#include "supervisor.h"
+#include "trace.h"
+#include "sched_core.h"
+#include "sched_port.h"
+#include "sched_idle.h"
+#include "sched_input.h"
+#include "sched_load.h"
 
 /* ===== 전역 변수 ===== */
 /* 시간 */
@@ -24,66 +21,175 @@ static volatile uint8_t g_flag_10ms = 0;
 static volatile uint8_t g_flag_50ms = 0;
 static uint8_t s_acc_1ms  = 0;  // 1ms → 10ms
 static uint8_t s_acc_10ms = 0;  // 10ms → 50ms(×5)
+static uint16_t s_flag_lost = 0; // run_tasks() 가 처리하기 전에 다시 올라간 10ms 플래그
+
+/* 스케줄러 모드 제어
+ * 모드 = 틱 핸들러 함수 포인터. 부팅 윈도우가 끝나면 tick_boot → tick_normal 로
+ * 한 번 교체하고 틱 소스 주기도 함께 바꾼다 → 정상 상태 ISR 에는 모드 분기가 없다.
+ */
+static uint8_t g_boot_mode = 1;        // 부팅 모드 (1ms 정밀도) — 조회용
+static uint32_t g_boot_timeout = SCH_BOOT_TIMEOUT_MS; // 10초 후 일반 모드로 전환
+static uint8_t s_normal_res = SCH_NORMAL_RES_MS;      // 일반 모드 해상도 = 태스크 res_ms 최소값
+
+/* 시간 원점 / 시간 압축 (호스트 소크 시뮬레이션 — 타깃은 원점 0, 건너뛰기 없음) */
+static uint32_t s_tick_origin = 0;      // 부팅 시 g_tick_ms 시작 값
+static bool     s_fast_forward = false; // sch_idle(): 다음 마감 직전까지 빈 틱을 건너뜀
+static uint32_t s_isr_skip = 0;         // 다음 test_isr() 가 주기에 더해 진행할 시간
+static uint32_t s_isr_step = SCH_BOOT_RES_MS; // 이번 test_isr() 가 진행한 시간 (= 디스패치 구간)
+
+/* 정적 테이블 시간축: 부팅 후 경과, 모든 오프셋을 지나면 하이퍼피리어드 단위로 접음
+ * → g_tick_ms/경과 시간 래핑과 무관하게 위상 유지 (init_task 에서 계산)
+ */
+static uint32_t s_table_ms = 0;
+static uint32_t s_table_hyper = SCH_NORMAL_RES_MS;  // lcm(주기들, 일반 해상도)
+static uint32_t s_table_fold = 2 * SCH_NORMAL_RES_MS; // 이 값 이상이면 s_table_hyper 만큼 뒤로
+
+/* 동적 태스크 슬롯 (sched_core) */
+static sc_task_t s_tasks[MAX_TASKS];
+static sc_sched_t s_sched;
+static SC_POOL_STORAGE(s_ctx_mem, SCH_CTX_BLOCK, SCH_CTX_COUNT);
+static sc_pool_t s_ctx_pool;
 
-/* 스케줄러 모드 제어 */
-static uint8_t g_boot_mode = 1;        // 부팅 모드 (1ms 정밀도)
-static uint32_t g_boot_timeout = 10000; // 10초 후 일반 모드로 전환
+/* 계측 (정적 테이블 — 동적 슬롯은 코어가 보관) */
+static uint16_t s_table_stack_max[SCH_TASK_COUNT];
 
-/* 테스크 슬롯 */
-static task_slot_t s_tasks[MAX_TASKS];
+/* 과부하 감지: 틱 ISR 실행 시간이 틱 주기를 넘으면 관측 → 비중요 정적 태스크/LOW 동적 슬롯 솎음 */
+static sc_load_t s_load;
+static uint8_t s_table_shed_cnt[SCH_TASK_COUNT];
+
+/* 유휴 관리 (슬립 단계 결정 + 틱당 여유/이용률) */
+static sc_idle_t s_idle;
 
 /* ===== 내부 함수 선언 ===== */
 static void init_task_slot(void);
 static void register_tasks(void);
-static void register_task(task_mode_t mode, task_fn_t fn, uint16_t delay_ms, uint16_t period_ms);
+static int register_task(task_mode_t mode, task_fn_t fn, uint16_t delay_ms, uint16_t period_ms);
 static void unregister_task(int idx);
-static void run_task_scheduler(void);
-static inline int time_after_eq(uint32_t a, uint32_t b);
+static void run_static_table(uint32_t now, uint32_t res);
 static void run_task_10ms(void);
 static void run_task_50ms(void);
+static void tick_boot(void);
+static void tick_normal(void);
+static void switch_to_normal(void);
+static void tick_source_set_period(uint8_t period_ms);
+
+/* 현재 모드의 틱 핸들러 (부팅 → 일반 전환 시 1회 교체) */
+static void (*volatile s_tick_fn)(void) = tick_boot;
 
 /* ===== ISR 시뮬레이션 ===== */
 
+/* 틱 초과 보고: 이번 ISR 실행 시간 - 틱 주기 (ms 올림, 호스트 가상 시간 모드는 항상 0) — 감지기의 유일한 보고자 */
+static void tick_overrun(sc_time_t t0) {
+  uint32_t used_us = (uint32_t)(sc_time_us() - t0);
+  uint32_t period_us = (uint32_t)sc_port_tick_period() * 1000u;
+  sc_load_report(&s_load, (used_us > period_us) ? (used_us - period_us + 999u) / 1000u : 0);
+}
+
 void test_isr(void)
 {
-  g_tick_ms++;
-  
-  // 부팅 모드 체크 및 전환
-  if (g_boot_mode && g_tick_ms > g_boot_timeout) {
-    g_boot_mode = 0;  // 일반 모드로 전환
-  }
-  
-  // 부팅 중에만 1ms마다 스케줄러 실행
-  if (g_boot_mode) {
-    run_task_scheduler();
-  }
+  sc_time_t t0 = sc_time_us();
+  s_isr_step = sc_port_tick_period() + s_isr_skip;   // 건너뛴 빈 틱 포함
+  s_isr_skip = 0;
+  g_tick_ms += s_isr_step;
+  s_table_ms += s_isr_step;
+  while (s_table_ms >= s_table_fold) s_table_ms -= s_table_hyper;
+  sc_in_capture(g_tick_ms);   // 입력 래치 — 이번 틱 태스크는 모두 이 스냅샷을 읽음
+  trace_event(TRACE_EV_ISR_ENTER, 0);
+  sup_tick(g_tick_ms);   // 예산/워치독 감시
+  s_tick_fn();
+  tick_overrun(t0);
+  trace_event(TRACE_EV_ISR_EXIT, 0);
+}
 
-  if (++s_acc_1ms >= 10) {        // 10ms 도래
-    s_acc_1ms = 0;
+/* 10ms/50ms 플래그 누적 (틱 주기는 10 의 약수, 건너뛴 구간은 경계 여러 개를 한 번에) */
+static inline void tick_flags(uint32_t step) {
+  uint32_t acc = s_acc_1ms + step;
+  if (acc >= 10) {                // 10ms 도래
+    uint32_t n10 = s_acc_10ms + acc / 10;
+    s_acc_1ms = (uint8_t)(acc % 10);
+    if (g_flag_10ms) s_flag_lost++;   // 이전 프레임 미처리 → 합쳐짐
     g_flag_10ms = 1;
-    
-    // 일반 모드에서는 10ms마다 스케줄러 실행
-    if (!g_boot_mode) {
-      run_task_scheduler();
-    }
 
-    if (++s_acc_10ms >= 5) {      // 50ms
-      s_acc_10ms = 0;
+    if (n10 >= 5) {               // 50ms
       g_flag_50ms = 1;
     }
+    s_acc_10ms = (uint8_t)(n10 % 5);
+  } else {
+    s_acc_1ms = (uint8_t)acc;
+  }
+}
+
+/* 부팅 모드: 1ms 마다 디스패치 + 부팅 윈도우 종료 검사 */
+static void tick_boot(void) {
+  uint32_t up = g_tick_ms - s_tick_origin;   // 부팅 후 경과 (원점 무관, 부팅 윈도우 안에서만 사용)
+  run_static_table(s_table_ms, s_isr_step);
+  sc_run(&s_sched, g_tick_ms);
+  tick_flags(s_isr_step);
+
+  // 새 해상도 격자 경계에서만 전환 → 첫 일반 틱이 격자와 정렬됨
+  if (up >= g_boot_timeout && (up % s_normal_res) == 0) {
+    switch_to_normal();
   }
 }
 
+/* 일반 모드: 틱 = 해상도, 검사 없이 디스패치만 */
+static void tick_normal(void) {
+  run_static_table(s_table_ms, s_isr_step);
+  sc_run(&s_sched, g_tick_ms);
+  tick_flags(s_isr_step);
+}
+
+/*
+ * @brief 부팅 → 일반 모드 전환 (1회)
+ * @details 동적 슬롯의 대기 중 마감 시각을 새 해상도 격자로 올림 정렬한다.
+ *          격자 밖 마감은 어차피 다음 격자 틱에 실행되므로, 미리 정렬해 두면
+ *          REPEAT 태스크의 due = now + period 가 격자 위에 유지되어 누적 지연이 없다.
+ *          정적 테이블은 위상 계산이므로 재정렬이 필요 없다.
+ */
+static void switch_to_normal(void) {
+  sc_align(&s_sched, g_tick_ms, s_normal_res);
+
+  g_boot_mode = 0;
+  s_acc_1ms = 0;                        // now 는 10ms 경계
+  tick_source_set_period(s_normal_res);
+  s_tick_fn = tick_normal;
+}
+
+/*
+ * @brief 틱 소스 주기 변경
+ * @note  타깃: 포트가 타이머 분주 재설정 / 호스트: test_isr() 1회 = period_ms 로 간주
+ */
+static void tick_source_set_period(uint8_t period_ms) {
+  sc_port_tick_set_period(period_ms);
+}
+
+uint8_t sch_tick_period_ms(void) {
+  return sc_port_tick_period();
+}
+
+/* 동적 슬롯 시작/종료 → 트레이스 (태그 = 슬롯 인덱스) */
+static void slot_begin(uint8_t tag) {
+  trace_event(TRACE_EV_TASK_BEGIN, (uint8_t)(TRACE_ID_SLOT + tag));
+}
+
+static void slot_end(uint8_t tag) {
+  trace_event(TRACE_EV_TASK_END, (uint8_t)(TRACE_ID_SLOT + tag));
+}
+
 /*
 * @brief 태스크 초기화
 */
- static void init_task_slot(void) {
-  for (int i = 0; i < MAX_TASKS; ++i) {
-    s_tasks[i].fn = NULL;
-    s_tasks[i].mode = TASK_ONESHOT;
-    s_tasks[i].active = 0;
-    s_tasks[i].due_ms = 0;
-    s_tasks[i].period_ms = 0;
+static void init_task_slot(void) {
+  sc_init(&s_sched, s_tasks, MAX_TASKS);
+  sc_set_hooks(&s_sched, slot_begin, slot_end);
+  sc_pool_init(&s_ctx_pool, s_ctx_mem, SCH_CTX_BLOCK, SCH_CTX_COUNT);
+  sc_set_pool(&s_sched, &s_ctx_pool);
+  sc_load_init(&s_load, SCH_LOAD_LATE_MS, SCH_LOAD_ENTER, SCH_LOAD_EXIT);
+  // sc_run() 은 틱 ISR 안에서 돌아 슬롯 지연이 늘 0 → 보고는 tick_overrun() 한 곳, 코어는 솎음 판정만
+  sc_set_load_admit(&s_sched, &s_load);
+  for (int i = 0; i < SCH_TASK_COUNT; ++i) {
+    s_table_stack_max[i] = 0;
+    s_table_shed_cnt[i] = 0;
   }
 }
 
@@ -94,69 +200,43 @@ void test_isr(void)
  * @param fn        태스크 함수 포인터
  * @param delay_ms  최초 지연 시간 (ms)
  * @param period_ms 반복 주기 (TASK_REPEAT 모드에서만 사용, 0이면 1회 실행 후 중지)
+ * @return 0: 성공, -1: 슬롯 부족, -2: 잘못된 파라미터
  */
-static void register_task(task_mode_t mode, task_fn_t fn, uint16_t delay_ms, uint16_t period_ms) {
-  if (!fn) return;
-  for (int i = 0; i < MAX_TASKS; ++i) {
-    if (!s_tasks[i].active) {
-      s_tasks[i].fn = fn;
-      s_tasks[i].mode = mode;
-      s_tasks[i].active = 1;
-      s_tasks[i].due_ms = g_tick_ms + delay_ms;
-      // 모드별 주기 설정 (등록 시 고정)
-      if (mode == TASK_REPEAT) {
-        s_tasks[i].period_ms = period_ms;  // 사용자 지정 주기
-      } else {  // TASK_ONESHOT
-        s_tasks[i].period_ms = 0;
-      }
-      return;  // 등록 성공 시 즉시 리턴
-    }
-  }
+static int register_task(task_mode_t mode, task_fn_t fn, uint16_t delay_ms, uint16_t period_ms) {
+  // TASK_REPEAT 이라도 period_ms=0 이면 1회 실행 후 중지 = ONESHOT
+  uint16_t period = (mode == TASK_REPEAT) ? period_ms : 0;
+  int id = sc_add0_at(&s_sched, fn, g_tick_ms + delay_ms, period);
+  return (id < 0) ? id : 0;
 }
 
-/*
- * @brief 태스크 등록 해제
- * @param idx 태스크 슬롯 인덱스
- */
-static void unregister_task(int idx) {
-  if (idx < 0 || idx >= MAX_TASKS) return;
-  s_tasks[idx].active = 0;
-  s_tasks[idx].fn = NULL;
+int sch_post_oneshot(task_fn_t fn, uint16_t delay_ms) {
+  return register_task(TASK_ONESHOT, fn, delay_ms, 0);
 }
 
-/*
- * @brief 태스크 스케줄러 실행 (ISR에서 호출)
- */
-static void run_task_scheduler(void) {
-  uint32_t now = g_tick_ms;
-  
-  for (int i = 0; i < MAX_TASKS; ++i) {
-    if (!s_tasks[i].active || !s_tasks[i].fn) continue;
-    
-    if (time_after_eq(now, s_tasks[i].due_ms)) {
-      
-      if (s_tasks[i].mode == TASK_ONESHOT) {
-        s_tasks[i].fn();
-        s_tasks[i].active = 0;
-        s_tasks[i].fn = NULL;
-      } else {  // TASK_REPEAT
-        s_tasks[i].fn();
-        if (s_tasks[i].period_ms == 0) {
-          s_tasks[i].active = 0;  // period_ms=0이면 중지
-        } else {
-          s_tasks[i].due_ms = now + s_tasks[i].period_ms;
-        }
-      }
-    }
-  }
+int sch_post_oneshot_at_us(task_fn_t fn, uint64_t due_us) {
+  int id = sc_add0_at_us(&s_sched, fn, due_us, 0);
+  return (id < 0) ? id : 0;
 }
 
-/* ===== 오버플로 안전 비교(a가 b 이후 또는 동일이면 true) ===== */
-static inline int time_after_eq(uint32_t a, uint32_t b) {
-  return (int32_t)(a - b) >= 0;
+int sch_post_ctx(task_ctx_fn_t fn, const void* ctx, uint8_t size, uint16_t delay_ms, uint16_t period_ms) {
+  return sc_add_ctx_at(&s_sched, fn, ctx, size, g_tick_ms + delay_ms, period_ms);
 }
 
-/* ===== 공용 API 함수 ===== */
+void sch_cancel(int id) {
+  unregister_task(id);
+}
+
+int sch_set_critical(int id, bool critical) {
+  return sc_set_crit(&s_sched, id, critical ? SC_CRIT_HIGH : SC_CRIT_LOW);
+}
+
+/*
+ * @brief 태스크 등록 해제
+ * @param idx 태스크 슬롯 인덱스
+ */
+static void unregister_task(int idx) {
+  sc_cancel(&s_sched, idx);
+}
 
 /* ===== 공용 API 함수 ===== */
 
@@ -191,19 +271,132 @@ static void demo_led_repeat(void) {
   level = !level;
 }
 
+/* ===== 정적 태스크 테이블 ===== */
+
+/* 이용률 컴파일 타임 검사 (ppm) — 응답 시간/틱 예산 분석은 tools/sch_gen */
+#define SCH_TASK(name, fn, period_ms, offset_ms, wcet_us, budget_ms, critical, res_ms) \
+  + ((period_ms) ? (uint64_t)(wcet_us) * 1000ULL / (period_ms) : 0ULL)
+_Static_assert(0 
+#include "sch_tasks.def"
+  <= (uint64_t)SCH_BUDGET_PCT * 10000ULL, "sch_tasks.def: utilization overload");
+#undef SCH_TASK
+
+#include "sch_table.h"  /* s_sch_table[] (tools/sch_gen 생성) */
+
+/* 정적 태스크 중요도 (sch_tasks.def 의 critical) — 비중요 태스크만 과부하 시 솎음 */
+static const uint8_t s_table_crit[SCH_TASK_COUNT] = {
+#define SCH_TASK(name, fn, period_ms, offset_ms, wcet_us, budget_ms, critical, res_ms) \
+  (critical) ? SC_CRIT_HIGH : SC_CRIT_LOW,
+#include "sch_tasks.def"
+#undef SCH_TASK
+};
+
+/*
+ * @brief 정적 테이블 디스패치 (RAM 슬롯 없음)
+ * @param now 테이블 시간축 (s_table_ms)
+ * @param res 현재 스케줄러 호출 주기 — 직전 호출 이후 [now-res+1, now] 구간 릴리즈를 실행
+ * @note  테이블은 릴리즈 시각 순 정렬이므로 아직 offset 전인 엔트리를 만나면 종료
+ *        offset 은 부팅 기준 — 시간축이 g_tick_ms 가 아니라 접힌 경과 시간이므로
+ *        래핑 후에도 오프셋 전으로 돌아가거나 주기 위상이 밀리지 않는다
+ *        (접은 뒤에도 now ≥ 최대 offset + 하이퍼피리어드 → 1회성은 다시 실행되지 않음, res ≤ 하이퍼피리어드)
+ */
+static void run_static_table(uint32_t now, uint32_t res) {
+  for (int i = 0; i < SCH_TABLE_LEN; ++i) {
+    const sch_entry_t* e = &s_sch_table[i];
+    if (now < e->offset_ms) break;
+
+    uint32_t since = now - e->offset_ms;
+    if ((e->period_ms == 0) ? (since < res) : (since % e->period_ms < res)) {
+      if (e->period_ms && !sc_load_admit(&s_load, s_table_crit[e->id], &s_table_shed_cnt[e->id])) continue;
+      trace_event(TRACE_EV_TASK_BEGIN, (uint8_t)(TRACE_ID_STATIC + e->id));
+      sup_task_begin(e->id);
+      sc_call_measured(e->fn, &s_table_stack_max[e->id]);
+      sup_task_end(e->id);
+      trace_event(TRACE_EV_TASK_END, (uint8_t)(TRACE_ID_STATIC + e->id));
+    }
+  }
+}
+
+/*
+ * @brief 정적 테이블의 now 이후 첫 릴리즈
+ * @param now 테이블 시간축 (s_table_ms) — due 도 같은 시간축
+ * @return false: 남은 릴리즈 없음 (1회성만 있고 모두 지남)
+ */
+static bool next_static_release(uint32_t now, uint32_t* due) {
+  bool found = false;
+  uint32_t best = 0;
+  for (int i = 0; i < SCH_TABLE_LEN; ++i) {
+    const sch_entry_t* e = &s_sch_table[i];
+    uint32_t ahead;
+    if (now < e->offset_ms)      ahead = e->offset_ms - now;
+    else if (e->period_ms == 0)  continue;
+    else                         ahead = e->period_ms - (now - e->offset_ms) % e->period_ms;
+    if (!found || ahead < best) best = ahead;
+    found = true;
+  }
+  if (found) *due = now + best;
+  return found;
+}
+
 /* ===== 초기화 및 등록 ===== */
 
+static uint32_t gcd_u32(uint32_t a, uint32_t b) {
+  while (b) { uint32_t t = a % b; a = b; b = t; }
+  return a;
+}
+
+/* 테이블 시간축 초기화: 하이퍼피리어드 H, 접기 기준 = 최대 offset + 2H */
+static void init_table_time(void) {
+  uint32_t hyper = SCH_NORMAL_RES_MS, max_off = 0;
+  for (int i = 0; i < SCH_TABLE_LEN; ++i) {
+    const sch_entry_t* e = &s_sch_table[i];
+    if (e->period_ms) hyper = hyper / gcd_u32(hyper, e->period_ms) * e->period_ms;
+    if (e->offset_ms > max_off) max_off = e->offset_ms;
+  }
+  s_table_ms = 0;
+  s_table_hyper = hyper;
+  s_table_fold = max_off + 2 * hyper;
+}
+
 /* 태스크 시작 전 초기화 목록*/
 void init_task(void) {
+   // 리셋(워치독 포함) 후 재진입 시 시간/모드 상태도 부팅 직후 값으로
+   g_tick_ms = s_tick_origin;
+   s_isr_skip = 0;
+   init_table_time();
+   g_flag_10ms = 0;
+   g_flag_50ms = 0;
+   s_flag_lost = 0;
+   s_acc_1ms = 0;
+   s_acc_10ms = 0;
+   g_boot_mode = 1;
+   s_tick_fn = tick_boot;
+   sc_port_tick_start(SCH_BOOT_RES_MS, test_isr);  // 호스트: 주기 기록, sch_idle() 슬립이 test_isr 호출
+
+   // 일반 모드 해상도 = 선언된 태스크 해상도 중 최소값
+   s_normal_res = SCH_NORMAL_RES_MS;
+#define SCH_TASK(name, fn, period_ms, offset_ms, wcet_us, budget_ms, critical, res_ms) \
+   if ((res_ms) < s_normal_res) s_normal_res = (res_ms);
+#include "sch_tasks.def"
+#undef SCH_TASK
+
    init_task_slot();      // 태스크 슬롯 초기화
+   sc_idle_init(&s_idle);
+   trace_reset();         // 트레이스 버퍼 비우기
+   sup_init();            // 예산 감시/워치독 시작
+#define SCH_TASK(name, fn, period_ms, offset_ms, wcet_us, budget_ms, critical, res_ms) \
+   sup_register(SCH_TASK_ID_##name, (budget_ms), (critical), NULL);
+#include "sch_tasks.def"
+#undef SCH_TASK
    register_tasks();  // 사용자 태스크 등록
    // init_fault_detection(); // ! TODO :  필요 없을 것 같다.
 }
 
 static void register_tasks(void)
 {
+  // 주기 태스크는 sch_tasks.def → s_sch_table (ROM) 에서 실행
+  // 여기서는 런타임에만 결정되는 동적 태스크만 등록
   register_task(TASK_ONESHOT, demo_boot_oneshot, 5000, 0);   // 5초 후 1회 실행 
-  register_task(TASK_REPEAT, fault_input_10ms_task, 2000, 1000);      // 2초 후 시작, 1초 주기
 }
 
 
@@ -214,4 +407,106 @@ void run_tasks(void)
 {
   run_task_10ms();  // 통합 스케줄러 실행
   run_task_50ms();  // 50ms 전용 (필요시)
-}
\ No newline at end of file
+}
+
+#if SC_PORT_HOST
+/*
+ * @brief 시간 압축: 다음 마감 직전까지 빈 틱을 건너뜀 (호스트 가상 시간 전용)
+ * @param ahead 다음 마감까지 남은 시간 (UINT32_MAX = 마감 없음)
+ * @details 건너뛴 시간은 다음 test_isr() 한 번이 몰아서 진행한다. 틱 단위 판정이 있는
+ *          시각(워치독 윈도우 끝, 부팅 윈도우 끝)은 넘지 않는다.
+ */
+static void fast_forward(uint32_t now, uint32_t ahead) {
+  uint32_t period = sc_port_tick_period();
+  uint32_t wnd = sup_window_end() - now;
+  if (wnd < ahead) ahead = wnd;
+  if (g_boot_mode) {
+    uint32_t up = now - s_tick_origin;
+    if (up >= g_boot_timeout) return;   // 격자 경계 전환까지 틱 단위로
+    if (g_boot_timeout - up < ahead) ahead = g_boot_timeout - up;
+  }
+  if (s_table_hyper < ahead) ahead = s_table_hyper;    // 테이블 시간축 접기 조건 (res ≤ 하이퍼피리어드)
+  if (ahead <= period) return;
+
+  uint32_t skip = (ahead - period) / period * period;   // 마감 틱은 실제로 발생
+  sc_port_sim_fast_forward(skip);
+  s_isr_skip = skip;
+}
+#endif
+
+/*
+ * @brief 다음 틱까지 슬립
+ * @details 태스크는 틱 ISR 안에서 실행되므로 깨어날 이벤트는 항상 다음 틱이다.
+ *          다음 마감(동적 슬롯 + 정적 테이블)까지 남은 시간으로 슬립 단계만 고른다.
+ */
+void sch_idle(void)
+{
+  uint32_t now = g_tick_ms;
+  uint32_t due = 0, sdue;
+  bool has_due = sc_next_due(&s_sched, now, &due);
+  if (next_static_release(s_table_ms, &sdue)) {
+    sdue = now + (sdue - s_table_ms);   // 테이블 시간축 → 틱
+    if (!has_due || (int32_t)(sdue - due) < 0) {
+      due = sdue;
+      has_due = true;
+    }
+  }
+#if SC_PORT_HOST
+  if (s_fast_forward) fast_forward(now, has_due ? due - now : UINT32_MAX);
+#endif
+  sc_idle_sleep(&s_idle, now, has_due, due);
+}
+
+void sch_sim_set_origin(uint32_t origin_ms)
+{
+  s_tick_origin = origin_ms;
+}
+
+void sch_sim_fast_forward(bool on)
+{
+  s_fast_forward = on;
+}
+
+void sch_get_idle_stats(sch_idle_stats_t* out)
+{
+  if (!out) return;
+  sc_idle_t id;
+  sc_idle_get(&s_idle, &id);
+  out->util_permille = id.util_permille;
+  out->util_peak = id.util_peak;
+  out->slack_min_us = (id.slack_min_us == UINT32_MAX) ? 0 : id.slack_min_us;
+  out->slack_last_us = id.slack_last_us;
+  out->sleeps_light = id.sleeps_light;
+  out->sleeps_deep = id.sleeps_deep;
+}
+
+void sch_get_stats(sch_stats_t* out)
+{
+  if (!out) return;
+  sc_stats_t st;
+  sc_get_stats(&s_sched, &st);
+  for (int i = 0; i < SCH_TASK_COUNT; ++i) out->table_stack_max[i] = s_table_stack_max[i];
+  for (int i = 0; i < MAX_TASKS; ++i) out->slot_stack_max[i] = s_tasks[i].stack_max;
+  out->slot_used = st.used;
+  out->slot_hwm = st.hwm;
+  out->slot_cap = st.cap;
+  out->alloc_fail = st.alloc_fail;
+
+  sc_pool_stats_t ps;
+  sc_pool_get_stats(&s_ctx_pool, &ps);
+  out->ctx_used = ps.used;
+  out->ctx_hwm = ps.hwm;
+  out->ctx_fail = ps.fail;
+
+  sc_load_stats_t ls;
+  sc_load_get_stats(&s_load, &ls);
+  out->load_level = ls.level;
+  out->load_level_max = ls.level_max;
+  out->load_enters = ls.enters;
+  out->load_recovers = ls.recovers;
+  out->tick_overruns = ls.overruns;
+  out->tick_late_max_ms = ls.late_max;
+  out->shed = ls.shed;
+  out->missed = ls.missed;
+  out->flag_lost = s_flag_lost;
+}
@@ -10,15 +10,189 @@
 #include <stdint.h>
 #include <stdbool.h>
 typedef void (*task_fn_t)(void);
+typedef void (*task_ctx_fn_t)(void* ctx);   ///< 컨텍스트 블록을 받는 태스크 (sch_post_ctx)
 typedef enum {
   TASK_ONESHOT = 0,   ///< 1회 실행 후 자동 해제
   TASK_REPEAT = 1,    ///< 주기적 반복 실행
 } task_mode_t;
 
 #define MAX_TASKS 10  ///< 최대 태스크 슬롯 개수
+
+/* ===== 태스크 컨텍스트 풀 (sch_post_ctx) ===== */
+#ifndef SCH_CTX_BLOCK
+#define SCH_CTX_BLOCK 16          ///< 컨텍스트 블록 크기 (bytes)
+#endif
+#ifndef SCH_CTX_COUNT
+#define SCH_CTX_COUNT MAX_TASKS   ///< 블록 수 (동적 슬롯 수 이상은 의미 없음)
+#endif
+
+/* ===== 스케줄러 해상도 (sch.c, tools/sch_gen.c 공용) ===== */
+#define SCH_BOOT_RES_MS      1      ///< 부팅 모드 스케줄러 호출 주기
+#define SCH_NORMAL_RES_MS    10     ///< 일반 모드 스케줄러 호출 주기
+#define SCH_BOOT_TIMEOUT_MS  10000  ///< 부팅 모드 유지 시간
+#define SCH_BUDGET_PCT       80     ///< 틱당 허용 부하 (%)
+
+/* ===== 과부하 감지 (sched_load) — 틱 ISR 실행 시간이 틱 주기를 넘은 만큼이 관측 지연 ===== */
+#ifndef SCH_LOAD_LATE_MS
+#define SCH_LOAD_LATE_MS     1      ///< 이 이상 초과하면 과부하 관측
+#endif
+#ifndef SCH_LOAD_ENTER
+#define SCH_LOAD_ENTER       3      ///< 연속 과부하 틱 → 단계 올림 (비중요 솎음 → 건너뜀)
+#endif
+#ifndef SCH_LOAD_EXIT
+#define SCH_LOAD_EXIT        100    ///< 연속 정상 틱 → 단계 내림
+#endif
+
+/**
+ * @brief 정적 디스패치 테이블 엔트리 (ROM 상주)
+ * @details sch_tasks.def 로부터 tools/sch_gen 이 sch_table.h 로 생성
+ *          period_ms = 0 이면 offset_ms 시점 1회 실행
+ */
+typedef struct {
+  task_fn_t fn;
+  uint32_t  period_ms;
+  uint32_t  offset_ms;
+  uint8_t   id;         ///< sch_tasks.def 선언 순서 (SCH_TASK_ID_xxx)
+} sch_entry_t;
+
+/** @brief 정적 태스크 ID (sch_tasks.def 선언 순서) */
+enum {
+#define SCH_TASK(name, fn, period_ms, offset_ms, wcet_us, budget_ms, critical, res_ms) SCH_TASK_ID_##name,
+#include "sch_tasks.def"
+#undef SCH_TASK
+  SCH_TASK_COUNT
+};
+
+/* ===== 스택/RAM 계측 =====
+ * 동적 슬롯과 스택 페인팅은 공용 코어(Schedular/core/sched_core) 가 담당한다.
+ * 창 크기는 SC_STACK_PAINT_BYTES (호스트 기본 4096, 0 = 비활성).
+ */
+
+/**
+ * @brief 스케줄러 계측 스냅샷
+ * @note  stack 값은 태스크 호출 지점 기준 사용 바이트 (SC_STACK_PAINT_BYTES 면 창 초과)
+ */
+typedef struct {
+  uint16_t table_stack_max[SCH_TASK_COUNT]; ///< 정적 태스크별 최대 스택 사용량
+  uint16_t slot_stack_max[MAX_TASKS];       ///< 동적 슬롯별 최대 스택 사용량
+  uint8_t  slot_used;                       ///< 현재 사용 중인 동적 슬롯 수
+  uint8_t  slot_hwm;                        ///< 동적 슬롯 최대 동시 사용 수
+  uint8_t  slot_cap;                        ///< MAX_TASKS
+  uint16_t alloc_fail;                      ///< 슬롯 부족으로 등록 실패한 횟수
+  uint8_t  ctx_used;                        ///< 사용 중인 컨텍스트 블록 수
+  uint8_t  ctx_hwm;                         ///< 컨텍스트 블록 최대 동시 사용 수
+  uint16_t ctx_fail;                        ///< 블록 부족으로 sch_post_ctx() 실패한 횟수
+  uint8_t  load_level;                      ///< 과부하 단계 (0 = 정상, 1 = 비중요 솎음, 2 = 비중요 건너뜀)
+  uint8_t  load_level_max;                  ///< 최대 도달 단계
+  uint16_t load_enters;                     ///< 정상 → 과부하 진입 횟수
+  uint16_t load_recovers;                   ///< 과부하 → 정상 복귀 횟수
+  uint16_t tick_overruns;                   ///< 틱 초과 관측 수 (SCH_LOAD_LATE_MS 이상)
+  uint16_t tick_late_max_ms;                ///< 최대 틱 초과 (ms)
+  uint32_t shed;                            ///< 차단으로 건너뛴 릴리즈 수 (비중요 정적 + LOW 동적)
+  uint32_t missed;                          ///< 한 주기 이상 밀려 합쳐진 동적 주기 슬롯 릴리즈 수
+  uint16_t flag_lost;                       ///< run_tasks() 처리 전에 다시 올라간 10ms 플래그 수
+} sch_stats_t;
+
+/**
+ * @brief 유휴 관리 계측 스냅샷
+ * @note  호스트는 실시간 모드(sc_port_sim_realtime)에서만 의미 있음 — 가상 시간 모드는 슬립 0
+ */
+typedef struct {
+  uint16_t util_permille;  ///< 직전 1초 창 CPU 이용률 (‰)
+  uint16_t util_peak;      ///< 창 단위 최대 이용률 (‰)
+  uint32_t slack_min_us;   ///< 최소 틱 여유 (실행 종료 ~ 다음 틱)
+  uint32_t slack_last_us;  ///< 마지막 틱 여유
+  uint32_t sleeps_light;   ///< 얕은 슬립 횟수 (다음 마감이 가까움)
+  uint32_t sleeps_deep;    ///< 깊은 슬립 횟수
+} sch_idle_stats_t;
+
 extern volatile uint32_t g_tick_ms;
 void init_task(void);
 void run_tasks(void);
 void test_isr(void);
 
+/**
+ * @brief 현재 틱 소스 주기 조회
+ * @return 1 (부팅 모드) 또는 일반 모드 해상도 (ms)
+ * @note  호스트 시뮬레이션은 test_isr() 1회를 이 값만큼의 시간 경과로 간주
+ */
+uint8_t sch_tick_period_ms(void);
+
+/**
+ * @brief 1회성 태스크 예약 (동적 슬롯)
+ * @param fn       태스크 함수
+ * @param delay_ms 지연 시간 (0 = 다음 스케줄러 호출)
+ * @return 0: 성공, -1: 슬롯 부족, -2: 잘못된 파라미터
+ * @note  ISR(정적 태스크 포함)에서 호출 가능 — 호출한 태스크와 같은 틱에 실행될 수 있음
+ */
+int sch_post_oneshot(task_fn_t fn, uint16_t delay_ms);
+
+/**
+ * @brief 1회성 태스크 예약 (64비트 us 절대 시각, sched_time.h 의 sc_time_us() 기준)
+ * @param due_us 실행 시각 — 그 이후 첫 스케줄러 호출에서 실행 (부팅 1ms / 일반 10ms 해상도)
+ * @return sch_post_oneshot() 과 같음
+ */
+int sch_post_oneshot_at_us(task_fn_t fn, uint64_t due_us);
+
+/**
+ * @brief 컨텍스트를 복사해 태스크 예약 (동적 슬롯 + 컨텍스트 풀)
+ * @param fn        태스크 함수 — 풀 블록에 복사된 컨텍스트 주소를 받음
+ * @param ctx       복사할 컨텍스트 (호출 후 재사용 가능)
+ * @param size      컨텍스트 크기 (1 ~ SCH_CTX_BLOCK)
+ * @param delay_ms  지연 시간
+ * @param period_ms 반복 주기 (0 = 1회성)
+ * @return 슬롯 ID (0 이상, sch_cancel() 용), -1: 슬롯/블록 부족, -2: 잘못된 파라미터
+ * @note  블록은 1회성 완료 또는 sch_cancel() 때 자동 반환. ISR 에서 호출 가능
+ */
+int sch_post_ctx(task_ctx_fn_t fn, const void* ctx, uint8_t size, uint16_t delay_ms, uint16_t period_ms);
+
+/**
+ * @brief sch_post_ctx() 로 예약한 태스크 취소 (컨텍스트 블록 반환)
+ * @param id sch_post_ctx() 반환값
+ */
+void sch_cancel(int id);
+
+/**
+ * @brief 동적 주기 태스크 중요도 설정 (기본: 지속 과부하에서만 솎음)
+ * @param id       sch_post_ctx() 반환값
+ * @param critical true: 과부하에도 항상 실행, false: 비중요 — 과부하 시 먼저 솎음
+ * @return 0: 성공, -1: 비활성 슬롯
+ */
+int sch_set_critical(int id, bool critical);
+
+/**
+ * @brief 메인 루프 유휴 처리: 다음 틱까지 슬립
+ * @note  run_tasks()/fault_log_commit() 뒤에 호출. 깨운 틱 인터럽트가 test_isr() 를 실행한다
+ *        (호스트 포트는 sc_port_sleep() 안에서 test_isr() 를 직접 호출)
+ */
+void sch_idle(void);
+
+/**
+ * @brief 부팅 시 g_tick_ms 시작 값 (init_task() 전에 호출, 기본 0)
+ * @note  래핑 직전 값을 주면 32비트 틱 래핑 경로를 부팅 직후 통과한다 (소크 시뮬레이션).
+ *        부팅 윈도우와 정적 테이블 오프셋은 이 원점 기준. sc_time_us() 원점은 그대로 0
+ *        → 원점을 옮기면 sch_post_oneshot_at_us() 는 쓰지 않는다
+ */
+void sch_sim_set_origin(uint32_t origin_ms);
+
+/**
+ * @brief 시간 압축 (호스트 가상 시간 전용)
+ * @param on true: sch_idle() 이 다음 마감(동적 슬롯, 정적 테이블, 워치독 윈도우 끝) 직전까지
+ *           빈 틱을 건너뛰고, 다음 test_isr() 가 건너뛴 시간을 한 번에 진행
+ * @note  건너뛴 틱에서는 입력 캡처/트레이스가 없다 — 타이밍 불변식 검사용, 회귀 출력 비교용 아님
+ */
+void sch_sim_fast_forward(bool on);
+
+/**
+ * @brief 유휴 관리 계측 값 조회
+ * @param out 결과 저장 위치 (NULL 이면 무시)
+ */
+void sch_get_idle_stats(sch_idle_stats_t* out);
+
+/**
+ * @brief 스케줄러 계측 값 조회
+ * @param out 결과 저장 위치 (NULL 이면 무시)
+ */
+void sch_get_stats(sch_stats_t* out);
+
 #endif // SCH_H
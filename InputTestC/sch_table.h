@@ -0,0 +1,17 @@
+/**
+ * @file sch_table.h
+ * @brief 정적 디스패치 테이블 (자동 생성 — 직접 수정 금지)
+ * @details tools/sch_gen 이 sch_tasks.def 로부터 생성, 릴리즈 시각 순 정렬
+ *          utilization 4000 ppm, hyperperiod 100 ms
+ */
+#ifndef SCH_TABLE_H
+#define SCH_TABLE_H
+
+static const sch_entry_t s_sch_table[] = {
+  { fault_input_sample_task, 10, 1910, SCH_TASK_ID_fault_sample },
+  { fault_input_10ms_task, 100, 2000, SCH_TASK_ID_fault_input },
+};
+
+#define SCH_TABLE_LEN 2
+
+#endif // SCH_TABLE_H
@@ -0,0 +1,186 @@
+/**
+ * @file supervisor.c
+ * @brief 태스크 실행 예산 감시 + 윈도우 워치독 구현
+ */
+
+#include "supervisor.h"
+#include "fault_input.h"
+#include <stdio.h>
+
+#if defined(__AVR__)
+#include <avr/wdt.h>
+#endif
+
+/* 외부 스케줄러 변수 */
+extern volatile uint32_t g_tick_ms;
+
+/* ===== 내부 타입 ===== */
+typedef struct {
+  sup_action_fn_t on_overrun;
+  uint32_t        start_ms;     // 현재 실행 시작 틱
+  uint16_t        budget_ms;    // 0 = 예산 감시 안 함
+  uint8_t         registered;
+  uint8_t         critical;
+  uint8_t         armed;        // critical: 첫 체크인 이후부터 윈도우 판정 대상
+  uint8_t         flagged;      // 이번 실행에서 이미 초과 보고함 (ISR 감지 포함)
+} sup_entry_t;
+
+/* ===== 전역 변수 ===== */
+static sup_entry_t s_sup[SUP_MAX_TASKS];
+static sup_stats_t s_sup_stats;               // wdt_resets 는 리셋 후에도 유지
+static volatile int16_t  s_running = -1;      // 실행 중인 태스크 ID (-1 = 없음)
+static volatile uint32_t s_checkin_mask = 0;  // 이번 윈도우에 체크인한 critical 태스크
+static uint32_t s_window_start = 0;
+static uint32_t s_last_tick = 0;              // 직전 sup_tick 시각 (틱 주기 가변 대응)
+static sup_reset_fn_t s_reset_hook = NULL;
+
+#if !defined(__AVR__)
+static volatile uint32_t s_wdt_remaining = SUP_WDT_TIMEOUT_MS;
+#endif
+
+/* ===== 워치독 포트 ===== */
+
+static void sup_wdt_start(void) {
+#if defined(__AVR__)
+  wdt_enable(WDTO_4S);
+#else
+  s_wdt_remaining = SUP_WDT_TIMEOUT_MS;
+#endif
+}
+
+static void sup_wdt_feed(void) {
+#if defined(__AVR__)
+  wdt_reset();
+#else
+  s_wdt_remaining = SUP_WDT_TIMEOUT_MS;
+#endif
+}
+
+/* 호스트: 하드웨어 리셋 대신 리셋 훅 호출 (훅이 없으면 카운트만) */
+static void sup_wdt_countdown(uint32_t elapsed) {
+#if !defined(__AVR__)
+  if (!s_wdt_remaining) return;
+  s_wdt_remaining = (elapsed >= s_wdt_remaining) ? 0 : s_wdt_remaining - elapsed;
+  if (s_wdt_remaining == 0) {
+    s_sup_stats.wdt_resets++;
+    printf("[WDT] Watchdog expired -> reset [count=%u, tick=%lu]\n",
+           s_sup_stats.wdt_resets, (unsigned long)g_tick_ms);
+    if (s_reset_hook) s_reset_hook();
+    s_wdt_remaining = SUP_WDT_TIMEOUT_MS;
+  }
+#else
+  (void)elapsed;
+#endif
+}
+
+/* ===== Public API ===== */
+
+void sup_init(void) {
+  for (int i = 0; i < SUP_MAX_TASKS; ++i) {
+    s_sup[i] = (sup_entry_t){ 0 };
+    s_sup_stats.overrun[i] = 0;
+  }
+  s_sup_stats.window_miss = 0;
+  s_running = -1;
+  s_checkin_mask = 0;
+  s_window_start = g_tick_ms;
+  s_last_tick = g_tick_ms;
+  sup_wdt_start();
+}
+
+int sup_register(uint8_t id, uint16_t budget_ms, bool critical, sup_action_fn_t on_overrun) {
+  if (id >= SUP_MAX_TASKS) return -2;
+  s_sup[id] = (sup_entry_t){ 0 };
+  s_sup[id].on_overrun = on_overrun;
+  s_sup[id].budget_ms = budget_ms;
+  s_sup[id].critical = critical ? 1 : 0;
+  s_sup[id].registered = 1;
+  s_sup_stats.overrun[id] = 0;
+  return 0;
+}
+
+void sup_unregister(uint8_t id) {
+  if (id >= SUP_MAX_TASKS) return;
+  s_sup[id].registered = 0;
+  s_checkin_mask &= ~(1UL << id);
+}
+
+void sup_move(uint8_t from, uint8_t to) {
+  if (from >= SUP_MAX_TASKS || to >= SUP_MAX_TASKS || from == to) return;
+  s_sup[to] = s_sup[from];
+  s_sup_stats.overrun[to] = s_sup_stats.overrun[from];
+  if (s_checkin_mask & (1UL << from)) s_checkin_mask |= (1UL << to);
+  else                                s_checkin_mask &= ~(1UL << to);
+  sup_unregister(from);
+}
+
+void sup_task_begin(uint8_t id) {
+  if (id >= SUP_MAX_TASKS || !s_sup[id].registered) return;
+  s_sup[id].start_ms = g_tick_ms;
+  s_sup[id].flagged = 0;
+  s_running = id;
+}
+
+void sup_task_end(uint8_t id) {
+  if (id >= SUP_MAX_TASKS || !s_sup[id].registered) return;
+  sup_entry_t* e = &s_sup[id];
+  s_running = -1;
+
+  if (e->budget_ms) {
+    uint32_t elapsed = g_tick_ms - e->start_ms;
+    bool over = e->flagged || elapsed > e->budget_ms;
+    if (over && !e->flagged) s_sup_stats.overrun[id]++;
+    fault_input_report_deadline(over);
+    if (over && e->on_overrun) e->on_overrun(id);
+  }
+
+  if (e->critical) {
+    e->armed = 1;
+    s_checkin_mask |= (1UL << id);
+  }
+}
+
+void sup_tick(uint32_t now) {
+  /* 행 감지: 실행 중 태스크가 예산을 넘기면 즉시 1회 기록 (조치는 종료 시점) */
+  int16_t run = s_running;
+  if (run >= 0) {
+    sup_entry_t* e = &s_sup[run];
+    if (e->budget_ms && !e->flagged && now - e->start_ms > e->budget_ms) {
+      e->flagged = 1;
+      s_sup_stats.overrun[run]++;
+    }
+  }
+
+  /* 윈도우 종료: 무장된 critical 태스크가 모두 체크인했을 때만 급식 */
+  if (now - s_window_start >= SUP_WDT_WINDOW_MS) {
+    uint32_t required = 0;
+    for (int i = 0; i < SUP_MAX_TASKS; ++i) {
+      if (s_sup[i].registered && s_sup[i].critical && s_sup[i].armed) required |= (1UL << i);
+    }
+    if ((s_checkin_mask & required) == required) {
+      sup_wdt_feed();
+    } else {
+      s_sup_stats.window_miss++;
+      printf("[WDT] Check-in missing [mask=0x%08lx, tick=%lu]\n",
+             (unsigned long)(required & ~s_checkin_mask), (unsigned long)now);
+    }
+    s_checkin_mask = 0;
+    s_window_start = now;
+  }
+
+  sup_wdt_countdown(now - s_last_tick);
+  s_last_tick = now;
+}
+
+uint32_t sup_window_end(void) {
+  return s_window_start + SUP_WDT_WINDOW_MS;
+}
+
+void sup_set_reset_hook(sup_reset_fn_t fn) {
+  s_reset_hook = fn;
+}
+
+void sup_get_stats(sup_stats_t* out) {
+  if (!out) return;
+  *out = s_sup_stats;
+}
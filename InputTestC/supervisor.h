@@ -0,0 +1,113 @@
+/**
+ * @file supervisor.h
+ * @brief 태스크 실행 예산 감시 + 윈도우 워치독
+ * @details - 태스크별 실행 예산(ms)을 틱 카운터로 감시, 초과 시 fault_input 의
+ *            SCHED 채널로 보고 (3회 연속 초과 → latched)
+ *          - 실행 중 예산을 넘긴 태스크(행)는 틱 ISR(sup_tick)에서 즉시 감지
+ *          - 중요(critical) 태스크가 윈도우 안에 모두 체크인해야만 워치독 급식
+ *          - AVR: avr/wdt.h, 호스트: 틱 기반 소프트웨어 워치독 + 리셋 훅
+ */
+#ifndef SUPERVISOR_H
+#define SUPERVISOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SUP_MAX_TASKS        32    ///< 감시 가능한 태스크 ID 수 (체크인 비트마스크 폭)
+
+#ifndef SUP_WDT_WINDOW_MS
+#define SUP_WDT_WINDOW_MS    1000  ///< 체크인 확인 윈도우 (가장 긴 critical 주기 이상)
+#endif
+
+#ifndef SUP_WDT_TIMEOUT_MS
+#define SUP_WDT_TIMEOUT_MS   4000  ///< 급식 없이 이 시간이 지나면 리셋
+#endif
+
+/**
+ * @brief 예산 초과 시 추가 조치 콜백 (예: driver_set_enable(name, false))
+ * @note  ISR 이 아닌 태스크 종료 시점에 호출됨
+ */
+typedef void (*sup_action_fn_t)(uint8_t id);
+
+/**
+ * @brief 호스트 빌드 리셋 훅 (워치독 만료 시 호출, 보통 longjmp 로 main 재시작)
+ */
+typedef void (*sup_reset_fn_t)(void);
+
+/**
+ * @brief 감시 상태 (디버깅/모니터링)
+ */
+typedef struct {
+  uint16_t overrun[SUP_MAX_TASKS];  ///< 태스크별 예산 초과 누적 횟수
+  uint16_t window_miss;             ///< 체크인 미달로 급식하지 못한 윈도우 수
+  uint16_t wdt_resets;              ///< 워치독 리셋 횟수 (호스트: 시뮬레이션)
+} sup_stats_t;
+
+/**
+ * @brief 감시 초기화 및 워치독 시작
+ */
+void sup_init(void);
+
+/**
+ * @brief 태스크 감시 등록
+ * @param id         태스크 ID (0 ~ SUP_MAX_TASKS-1)
+ * @param budget_ms  실행 예산 (0 = 예산 감시 안 함)
+ * @param critical   true: 워치독 윈도우마다 체크인 필수
+ * @param on_overrun 예산 초과 시 조치 (NULL 가능)
+ * @return 0: 성공, -2: 잘못된 파라미터
+ */
+int sup_register(uint8_t id, uint16_t budget_ms, bool critical, sup_action_fn_t on_overrun);
+
+/**
+ * @brief 감시 해제
+ */
+void sup_unregister(uint8_t id);
+
+/**
+ * @brief 감시 엔트리 이동 (슬롯 재배치 시 ID 변경)
+ */
+void sup_move(uint8_t from, uint8_t to);
+
+/**
+ * @brief 태스크 시작 (시작 틱 기록)
+ */
+void sup_task_begin(uint8_t id);
+
+/**
+ * @brief 태스크 종료 (예산 비교, 체크인, 보류된 조치 실행)
+ */
+void sup_task_end(uint8_t id);
+
+/**
+ * @brief 틱 ISR 에서 매 틱 호출 — 행 감지, 윈도우 판정, 워치독 카운트다운
+ * @note  틱 주기가 바뀌어도 직전 호출 이후 경과 시간으로 카운트다운
+ * @param now 현재 틱 (g_tick_ms)
+ */
+void sup_tick(uint32_t now);
+
+/**
+ * @brief 현재 체크인 윈도우가 끝나는 틱 (윈도우 판정이 일어나는 다음 시각)
+ * @note  빈 틱을 건너뛰는 유휴 경로(시뮬레이션 fast-forward)가 이 시각을 넘지 않아야
+ *        윈도우 길이와 워치독 카운트다운이 틱 단위 실행과 같다
+ */
+uint32_t sup_window_end(void);
+
+/**
+ * @brief 호스트 리셋 훅 등록 (AVR 빌드에서는 무시)
+ */
+void sup_set_reset_hook(sup_reset_fn_t fn);
+
+/**
+ * @brief 감시 통계 조회
+ */
+void sup_get_stats(sup_stats_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SUPERVISOR_H
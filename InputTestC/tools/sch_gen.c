@@ -0,0 +1,193 @@
+/**
+ * @file sch_gen.c
+ * @brief 정적 태스크 테이블 생성기 + 스케줄 가능성 분석 (호스트 빌드 도구)
+ * @details sch_tasks.def 를 읽어
+ *          1. 이용률 검사 (U <= SCH_BUDGET_PCT)
+ *          2. 틱 예산 검사 (같은 스케줄러 호출에 몰리는 WCET 합 <= 해상도 × 예산)
+ *          3. 응답 시간 분석 (RM 우선순위, 비선점 블로킹 포함, R <= period)
+ *          을 수행하고, 통과 시 릴리즈 시각 순으로 정렬된 sch_table.h 를 stdout 으로 출력한다.
+ *          하나라도 실패하면 exit code 1 → 빌드 중단.
+ *
+ *          gcc -Wall -I. tools/sch_gen.c -o sch_gen && ./sch_gen > sch_table.h
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "sch.h"
+
+typedef struct {
+  const char* name;
+  const char* fn;
+  uint32_t    period_ms;
+  uint32_t    offset_ms;
+  uint32_t    wcet_us;
+  uint32_t    res_ms;
+  int         id;
+} gen_task_t;
+
+static gen_task_t s_gen[] = {
+#define SCH_TASK(name, fn, period_ms, offset_ms, wcet_us, budget_ms, critical, res_ms) \
+  { #name, #fn, (period_ms), (offset_ms), (wcet_us), (res_ms), SCH_TASK_ID_##name },
+#include "sch_tasks.def"
+#undef SCH_TASK
+};
+
+#define GEN_COUNT ((int)(sizeof(s_gen) / sizeof(s_gen[0])))
+
+/* 시뮬레이션 구간 상한 (ms) — 하이퍼피리어드가 이보다 크면 잘라서 검사 */
+#define GEN_HORIZON_MAX_MS 600000UL
+
+static uint32_t gcd_u32(uint32_t a, uint32_t b) {
+  while (b) { uint32_t t = a % b; a = b; b = t; }
+  return a;
+}
+
+/* 릴리즈 시각(offset) 오름차순, 같으면 주기 오름차순 */
+static int cmp_release(const void* pa, const void* pb) {
+  const gen_task_t* a = (const gen_task_t*)pa;
+  const gen_task_t* b = (const gen_task_t*)pb;
+  if (a->offset_ms != b->offset_ms) return (a->offset_ms < b->offset_ms) ? -1 : 1;
+  if (a->period_ms != b->period_ms) return (a->period_ms < b->period_ms) ? -1 : 1;
+  return 0;
+}
+
+/* [t, t+res) 구간에 릴리즈되는 태스크들의 WCET 합 */
+static uint32_t window_load_us(uint32_t t, uint32_t res) {
+  uint32_t sum = 0;
+  for (int i = 0; i < GEN_COUNT; ++i) {
+    const gen_task_t* g = &s_gen[i];
+    uint32_t rel = g->offset_ms;
+    if (g->period_ms && rel < t) {
+      rel += (t - rel + g->period_ms - 1) / g->period_ms * g->period_ms;
+    }
+    if (rel < t) continue;  /* 이미 지난 1회성 태스크 */
+    while (rel < t + res) {
+      sum += g->wcet_us;
+      if (g->period_ms == 0) break;
+      rel += g->period_ms;
+    }
+  }
+  return sum;
+}
+
+/* 틱 예산 검사: 해상도 res 단위 창마다 부하 확인 */
+static int check_tick_budget(uint32_t res, uint32_t from_ms, uint32_t to_ms, const char* label) {
+  uint32_t budget_us = res * 1000UL * SCH_BUDGET_PCT / 100UL;
+  int ok = 1;
+  uint32_t worst = 0, worst_t = 0;
+  for (uint32_t t = from_ms; t < to_ms; t += res) {
+    uint32_t load = window_load_us(t, res);
+    if (load > worst) { worst = load; worst_t = t; }
+  }
+  fprintf(stderr, "[GEN] %s tick budget: worst %lu us @ %lu ms / %lu us\n",
+          label, (unsigned long)worst, (unsigned long)worst_t, (unsigned long)budget_us);
+  if (worst > budget_us) {
+    fprintf(stderr, "[GEN] ERROR: %s tick overload\n", label);
+    ok = 0;
+  }
+  return ok;
+}
+
+/* 비선점 RM 응답 시간 분석 (주기 태스크 대상) */
+static int check_response_time(void) {
+  int ok = 1;
+  for (int i = 0; i < GEN_COUNT; ++i) {
+    const gen_task_t* ti = &s_gen[i];
+    if (ti->period_ms == 0) continue;
+
+    uint64_t deadline_us = (uint64_t)ti->period_ms * 1000ULL;
+    uint64_t blocking = 0;
+    for (int j = 0; j < GEN_COUNT; ++j) {
+      const gen_task_t* tj = &s_gen[j];
+      int lower = (tj->period_ms == 0) || (tj->period_ms > ti->period_ms);
+      if (j != i && lower && tj->wcet_us > blocking) blocking = tj->wcet_us;
+    }
+
+    /* w = B + Σ(hp) (floor(w/T)+1)·C  — 고정점 반복 */
+    uint64_t w = blocking, prev = (uint64_t)-1;
+    while (w != prev && w <= deadline_us) {
+      prev = w;
+      w = blocking;
+      for (int j = 0; j < GEN_COUNT; ++j) {
+        const gen_task_t* tj = &s_gen[j];
+        if (j == i || tj->period_ms == 0 || tj->period_ms > ti->period_ms) continue;
+        w += (prev / ((uint64_t)tj->period_ms * 1000ULL) + 1) * tj->wcet_us;
+      }
+    }
+    uint64_t r = w + ti->wcet_us;
+
+    fprintf(stderr, "[GEN] %-16s T=%5lu ms C=%5lu us R=%7llu us\n", ti->name,
+            (unsigned long)ti->period_ms, (unsigned long)ti->wcet_us, (unsigned long long)r);
+    if (r > deadline_us) {
+      fprintf(stderr, "[GEN] ERROR: %s misses deadline\n", ti->name);
+      ok = 0;
+    }
+  }
+  return ok;
+}
+
+int main(void)
+{
+  int ok = 1;
+  uint64_t util_ppm = 0;
+  uint32_t hyper = 1, max_offset = 0;
+  uint32_t normal_res = SCH_NORMAL_RES_MS;
+
+  for (int i = 0; i < GEN_COUNT; ++i) {
+    const gen_task_t* g = &s_gen[i];
+    if (g->offset_ms > max_offset) max_offset = g->offset_ms;
+    if (g->res_ms == 0 || SCH_NORMAL_RES_MS % g->res_ms) {
+      fprintf(stderr, "[GEN] ERROR: %s res_ms %lu must divide %d\n",
+              g->name, (unsigned long)g->res_ms, SCH_NORMAL_RES_MS);
+      ok = 0;
+      continue;
+    }
+    if (g->res_ms < normal_res) normal_res = g->res_ms;
+    if (g->period_ms % g->res_ms || g->offset_ms % g->res_ms) {
+      fprintf(stderr, "[GEN] WARNING: %s is not aligned to its %lu ms resolution\n",
+              g->name, (unsigned long)g->res_ms);
+    }
+    if (g->period_ms == 0) continue;
+    util_ppm += (uint64_t)g->wcet_us * 1000ULL / g->period_ms;
+    hyper = (uint32_t)((uint64_t)hyper / gcd_u32(hyper, g->period_ms) * g->period_ms);
+  }
+
+  fprintf(stderr, "[GEN] utilization %llu.%02llu %% (limit %d %%)\n",
+          (unsigned long long)(util_ppm / 10000ULL), (unsigned long long)(util_ppm / 100ULL % 100ULL),
+          SCH_BUDGET_PCT);
+  if (util_ppm > (uint64_t)SCH_BUDGET_PCT * 10000ULL) {
+    fprintf(stderr, "[GEN] ERROR: utilization overload\n");
+    ok = 0;
+  }
+
+  uint64_t horizon = (uint64_t)max_offset + 2ULL * hyper;
+  if (horizon > GEN_HORIZON_MAX_MS) horizon = GEN_HORIZON_MAX_MS;
+
+  uint32_t boot_end = (SCH_BOOT_TIMEOUT_MS < horizon) ? SCH_BOOT_TIMEOUT_MS : (uint32_t)horizon;
+  ok &= check_tick_budget(SCH_BOOT_RES_MS, 0, boot_end, "boot");
+  ok &= check_tick_budget(normal_res, SCH_BOOT_TIMEOUT_MS, SCH_BOOT_TIMEOUT_MS + (uint32_t)horizon, "normal");
+  ok &= check_response_time();
+
+  if (!ok) return 1;
+
+  qsort(s_gen, GEN_COUNT, sizeof(s_gen[0]), cmp_release);
+
+  printf("/**\n");
+  printf(" * @file sch_table.h\n");
+  printf(" * @brief 정적 디스패치 테이블 (자동 생성 — 직접 수정 금지)\n");
+  printf(" * @details tools/sch_gen 이 sch_tasks.def 로부터 생성, 릴리즈 시각 순 정렬\n");
+  printf(" *          utilization %llu ppm, hyperperiod %lu ms\n",
+         (unsigned long long)util_ppm, (unsigned long)hyper);
+  printf(" */\n");
+  printf("#ifndef SCH_TABLE_H\n#define SCH_TABLE_H\n\n");
+  printf("static const sch_entry_t s_sch_table[] = {\n");
+  for (int i = 0; i < GEN_COUNT; ++i) {
+    printf("  { %s, %lu, %lu, SCH_TASK_ID_%s },\n", s_gen[i].fn,
+           (unsigned long)s_gen[i].period_ms, (unsigned long)s_gen[i].offset_ms, s_gen[i].name);
+  }
+  printf("};\n\n");
+  printf("#define SCH_TABLE_LEN %d\n\n", GEN_COUNT);
+  printf("#endif // SCH_TABLE_H\n");
+  return 0;
+}
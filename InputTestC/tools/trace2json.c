@@ -0,0 +1,183 @@
+/**
+ * @file trace2json.c
+ * @brief trace_dump() 텍스트 → Chrome/Perfetto 트레이스 JSON 변환기 (호스트 빌드 도구)
+ * @details 레코드는 tick 하위 16비트만 가지므로 헤더의 now_tick 에서 시작해
+ *          최신 레코드부터 역방향으로 전체 tick 을 복원한다.
+ *          (연속한 두 레코드 간격이 65.5초를 넘으면 그 이전 구간은 시각이 어긋남)
+ *          같은 tick 안의 이벤트는 순서 유지를 위해 1us 씩 벌려서 출력한다.
+ *
+ *          gcc -Wall -I. tools/trace2json.c -o trace2json
+ *          ./trace2json trace.txt > trace.json   → chrome://tracing 또는 ui.perfetto.dev
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sch.h"
+#include "fault_input.h"
+#include "trace.h"
+
+/* 타임라인 트랙 (tid) */
+enum {
+  TRK_ISR = 0,
+  TRK_STATIC,
+  TRK_SLOT,
+  TRK_DRIVER,
+  TRK_FAULT,
+};
+
+typedef struct {
+  uint32_t tick;
+  uint16_t tick_lo;
+  uint8_t  ev;
+  uint8_t  arg;
+} conv_rec_t;
+
+static const char* const s_static_names[SCH_TASK_COUNT] = {
+#define SCH_TASK(name, fn, period_ms, offset_ms, wcet_us, budget_ms, critical, res_ms) \
+  [SCH_TASK_ID_##name] = #name,
+#include "sch_tasks.def"
+#undef SCH_TASK
+};
+
+static const char* const s_fault_names[FAULT_CH_MAX] = {
+  [FAULT_CH_LCD] = "LCD", [FAULT_CH_LED] = "LED", [FAULT_CH_GMSL] = "GMSL", [FAULT_CH_SCHED] = "SCHED",
+};
+
+static int s_first = 1;
+
+/* 태스크 ID → 이름/트랙 */
+static void task_name(uint8_t id, char* buf, size_t len, int* tid) {
+  if (id >= TRACE_ID_DRIVER) {
+    snprintf(buf, len, "driver %u", (unsigned)(id - TRACE_ID_DRIVER));
+    *tid = TRK_DRIVER;
+  } else if (id >= TRACE_ID_SLOT) {
+    snprintf(buf, len, "slot %u", (unsigned)(id - TRACE_ID_SLOT));
+    *tid = TRK_SLOT;
+  } else {
+    if (id < SCH_TASK_COUNT) snprintf(buf, len, "%s", s_static_names[id]);
+    else                     snprintf(buf, len, "task %u", (unsigned)id);
+    *tid = TRK_STATIC;
+  }
+}
+
+static void emit(const char* name, const char* ph, uint64_t ts_us, int tid, const char* extra) {
+  printf("%s\n  {\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%llu,\"pid\":1,\"tid\":%d%s}",
+         s_first ? "" : ",", name, ph, (unsigned long long)ts_us, tid, extra ? extra : "");
+  s_first = 0;
+}
+
+static void emit_thread_name(int tid, const char* name) {
+  printf("%s\n  {\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+         s_first ? "" : ",", tid, name);
+  s_first = 0;
+}
+
+int main(int argc, char** argv)
+{
+  FILE* in = stdin;
+  if (argc > 1) {
+    in = fopen(argv[1], "r");
+    if (!in) {
+      fprintf(stderr, "[T2J] ERROR: cannot open %s\n", argv[1]);
+      return 1;
+    }
+  }
+
+  unsigned version = 0;
+  unsigned long now = 0, count = 0, dropped = 0;
+  if (fscanf(in, " TRACE %u %lu %lu %lu", &version, &now, &count, &dropped) != 4 || version != 1) {
+    fprintf(stderr, "[T2J] ERROR: bad header\n");
+    return 1;
+  }
+
+  conv_rec_t* recs = (conv_rec_t*)calloc(count ? count : 1, sizeof(conv_rec_t));
+  if (!recs) return 1;
+  unsigned long n = 0;
+  unsigned lo, ev, arg;
+  while (n < count && fscanf(in, " %x %x %x", &lo, &ev, &arg) == 3) {
+    recs[n].tick_lo = (uint16_t)lo;
+    recs[n].ev = (uint8_t)ev;
+    recs[n].arg = (uint8_t)arg;
+    n++;
+  }
+  if (in != stdin) fclose(in);
+  if (n != count) fprintf(stderr, "[T2J] WARNING: %lu of %lu records read\n", n, count);
+
+  /* 최신 → 과거 방향으로 전체 tick 복원 */
+  uint32_t full = (uint32_t)now;
+  uint16_t next_lo = (uint16_t)now;
+  for (unsigned long k = n; k-- > 0;) {
+    full -= (uint16_t)(next_lo - recs[k].tick_lo);
+    recs[k].tick = full;
+    next_lo = recs[k].tick_lo;
+  }
+
+  printf("{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":%lu},\"traceEvents\":[", dropped);
+  emit_thread_name(TRK_ISR, "tick ISR");
+  emit_thread_name(TRK_STATIC, "static table");
+  emit_thread_name(TRK_SLOT, "dynamic slots");
+  emit_thread_name(TRK_DRIVER, "drivers");
+  emit_thread_name(TRK_FAULT, "faults");
+
+  /* 버퍼 앞부분이 잘려 짝이 없는 END 는 건너뜀 */
+  uint8_t open_task[256] = { 0 };
+  uint8_t open_isr = 0;
+  uint32_t prev_tick = 0;
+  unsigned sub = 0;
+  char name[48];
+
+  for (unsigned long k = 0; k < n; ++k) {
+    const conv_rec_t* r = &recs[k];
+    sub = (k && r->tick == prev_tick && sub < 999) ? sub + 1 : 0;
+    prev_tick = r->tick;
+    uint64_t ts = (uint64_t)r->tick * 1000ULL + sub;
+    int tid;
+
+    switch (r->ev) {
+      case TRACE_EV_TASK_BEGIN:
+        task_name(r->arg, name, sizeof(name), &tid);
+        emit(name, "B", ts, tid, NULL);
+        open_task[r->arg]++;
+        break;
+      case TRACE_EV_TASK_END:
+        if (!open_task[r->arg]) break;
+        open_task[r->arg]--;
+        task_name(r->arg, name, sizeof(name), &tid);
+        emit(name, "E", ts, tid, NULL);
+        break;
+      case TRACE_EV_ISR_ENTER:
+        emit("tick", "B", ts, TRK_ISR, NULL);
+        open_isr++;
+        break;
+      case TRACE_EV_ISR_EXIT:
+        if (!open_isr) break;
+        open_isr--;
+        emit("tick", "E", ts, TRK_ISR, NULL);
+        break;
+      case TRACE_EV_FAULT_LATCH:
+      case TRACE_EV_FAULT_CLEAR:
+        snprintf(name, sizeof(name), "%s %s",
+                 (r->arg < FAULT_CH_MAX) ? s_fault_names[r->arg] : "CH?",
+                 (r->ev == TRACE_EV_FAULT_LATCH) ? "latched" : "cleared");
+        emit(name, "i", ts, TRK_FAULT, ",\"s\":\"g\"");
+        break;
+      case TRACE_EV_DRV_ENABLE:
+      case TRACE_EV_DRV_DISABLE:
+        snprintf(name, sizeof(name), "driver %u %s", (unsigned)r->arg,
+                 (r->ev == TRACE_EV_DRV_ENABLE) ? "enabled" : "disabled");
+        emit(name, "i", ts, TRK_DRIVER, ",\"s\":\"t\"");
+        break;
+      default:
+        fprintf(stderr, "[T2J] WARNING: unknown event 0x%02x\n", r->ev);
+        break;
+    }
+  }
+
+  printf("\n]}\n");
+  fprintf(stderr, "[T2J] %lu events, ticks %lu..%lu, %lu dropped\n", n,
+          n ? (unsigned long)recs[0].tick : 0UL, now, dropped);
+  free(recs);
+  return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file trace.c
+ * @brief 이벤트 트레이스 기록기 구현
+ */
+
+#include "trace.h"
+
+#if defined(__AVR__)
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#define TRACE_LOCK()    uint8_t _sreg = SREG; cli()
+#define TRACE_UNLOCK()  SREG = _sreg
+#else
+#define TRACE_LOCK()
+#define TRACE_UNLOCK()
+#endif
+
+#if (TRACE_CAP & (TRACE_CAP - 1)) != 0
+#error "TRACE_CAP must be a power of two"
+#endif
+
+/* 외부 스케줄러 변수 */
+extern volatile uint32_t g_tick_ms;
+
+/* ===== 전역 변수 ===== */
+static trace_rec_t s_trace[TRACE_CAP];
+static uint16_t s_head = 0;        // 다음 기록 위치 (누적, 마스크로 인덱싱)
+static uint16_t s_count = 0;       // 유효 레코드 수 (<= TRACE_CAP)
+static uint32_t s_dropped = 0;     // 덮어써진 레코드 수
+static volatile uint8_t s_enabled = 1;
+static trace_clock_fn_t s_clock = 0;  // NULL = g_tick_ms
+
+static uint32_t trace_now(void) {
+  return s_clock ? s_clock() : g_tick_ms;
+}
+
+void trace_set_clock(trace_clock_fn_t fn) {
+  s_clock = fn;
+}
+
+void trace_reset(void) {
+  TRACE_LOCK();
+  s_head = 0;
+  s_count = 0;
+  s_dropped = 0;
+  TRACE_UNLOCK();
+}
+
+void trace_enable(bool enable) {
+  s_enabled = enable ? 1 : 0;
+}
+
+void trace_event(trace_ev_t ev, uint8_t arg) {
+  if (!s_enabled) return;
+  TRACE_LOCK();
+  trace_rec_t* r = &s_trace[s_head & (TRACE_CAP - 1)];
+  r->tick_lo = (uint16_t)trace_now();
+  r->ev = (uint8_t)ev;
+  r->arg = arg;
+  s_head++;
+  if (s_count < TRACE_CAP) s_count++;
+  else                     s_dropped++;
+  TRACE_UNLOCK();
+}
+
+/* ===== 텍스트 덤프 ===== */
+
+static void put_hex(trace_putc_fn_t put, uint32_t v, uint8_t digits) {
+  static const char hex[] = "0123456789abcdef";
+  while (digits--) put(hex[(v >> (digits * 4)) & 0xF]);
+}
+
+static void put_dec(trace_putc_fn_t put, uint32_t v) {
+  char buf[10];
+  uint8_t n = 0;
+  do { buf[n++] = (char)('0' + v % 10); v /= 10; } while (v);
+  while (n) put(buf[--n]);
+}
+
+static void put_str(trace_putc_fn_t put, const char* s) {
+  while (*s) put(*s++);
+}
+
+void trace_dump(trace_putc_fn_t put) {
+  if (!put) return;
+  uint8_t was_enabled = s_enabled;
+  s_enabled = 0;
+
+  uint16_t count = s_count;
+  uint16_t first = (uint16_t)(s_head - count);
+
+  put_str(put, "TRACE 1 ");
+  put_dec(put, trace_now());
+  put(' ');
+  put_dec(put, count);
+  put(' ');
+  put_dec(put, s_dropped);
+  put('\n');
+
+  for (uint16_t i = 0; i < count; ++i) {
+    const trace_rec_t* r = &s_trace[(uint16_t)(first + i) & (TRACE_CAP - 1)];
+    put_hex(put, r->tick_lo, 4);
+    put(' ');
+    put_hex(put, r->ev, 2);
+    put(' ');
+    put_hex(put, r->arg, 2);
+    put('\n');
+  }
+  put_str(put, "END\n");
+
+  s_enabled = was_enabled;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file trace.h
+ * @brief 이벤트 트레이스 기록기 (고정 크기 원형 버퍼)
+ * @details 레코드 1개 = 4바이트 (tick 하위 16비트 + 이벤트 종류 + 인자)
+ *          버퍼가 차면 가장 오래된 레코드부터 덮어쓴다.
+ *          trace_dump() 의 텍스트 출력을 tools/trace2json 으로 Chrome/Perfetto
+ *          트레이스 JSON 으로 변환한다.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef TRACE_CAP
+#define TRACE_CAP 256   ///< 레코드 수 (2의 거듭제곱)
+#endif
+
+/* ===== 이벤트 종류 ===== */
+typedef enum {
+  TRACE_EV_TASK_BEGIN = 1,  ///< arg = 태스크 ID
+  TRACE_EV_TASK_END,        ///< arg = 태스크 ID
+  TRACE_EV_ISR_ENTER,       ///< arg = 0
+  TRACE_EV_ISR_EXIT,        ///< arg = 0
+  TRACE_EV_FAULT_LATCH,     ///< arg = fault 채널
+  TRACE_EV_FAULT_CLEAR,     ///< arg = fault 채널
+  TRACE_EV_DRV_ENABLE,      ///< arg = 드라이버 슬롯
+  TRACE_EV_DRV_DISABLE,     ///< arg = 드라이버 슬롯
+} trace_ev_t;
+
+/* ===== 태스크 ID 공간 (TASK_BEGIN/END 의 arg) ===== */
+#define TRACE_ID_STATIC   0x00  ///< + SCH_TASK_ID_xxx (정적 테이블)
+#define TRACE_ID_SLOT     0x40  ///< + 동적 슬롯 인덱스
+#define TRACE_ID_DRIVER   0x80  ///< + 드라이버 슬롯 인덱스
+
+/**
+ * @brief 트레이스 레코드 (4 bytes)
+ */
+typedef struct {
+  uint16_t tick_lo;   ///< 기록 시각 하위 16비트 (변환 시 역방향으로 펼침)
+  uint8_t  ev;        ///< trace_ev_t
+  uint8_t  arg;
+} trace_rec_t;
+
+/**
+ * @brief 문자 출력 함수 (printf 없는 타깃에서는 Serial.write 래퍼)
+ */
+typedef void (*trace_putc_fn_t)(char c);
+
+/**
+ * @brief 기록 시각 함수 (ms) — ISR 에서도 불림
+ */
+typedef uint32_t (*trace_clock_fn_t)(void);
+
+/**
+ * @brief 기록 시각 출처 지정 (기본 g_tick_ms)
+ * @param fn 예: 보드 간 동기 시각 (sc_sync_stamp() 래퍼), NULL = g_tick_ms
+ * @note  시각축이 바뀌면(동기 스텝) 이전 레코드와 섞이지 않도록 trace_reset() 권장
+ */
+void trace_set_clock(trace_clock_fn_t fn);
+
+/**
+ * @brief 버퍼 비우기
+ */
+void trace_reset(void);
+
+/**
+ * @brief 이벤트 기록 (ISR-safe)
+ */
+void trace_event(trace_ev_t ev, uint8_t arg);
+
+/**
+ * @brief 기록 일시 정지/재개 (덤프 중 덮어쓰기 방지)
+ */
+void trace_enable(bool enable);
+
+/**
+ * @brief 버퍼 내용을 텍스트로 출력 (오래된 것부터)
+ * @details 형식:
+ *          "TRACE 1 <now_tick> <count> <dropped>\n"
+ *          "<tick_lo hex4> <ev hex2> <arg hex2>\n" × count
+ *          "END\n"
+ */
+void trace_dump(trace_putc_fn_t put);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACE_H
@@ -1,42 +1,133 @@
 /* ultra_light_sched_arduino_fixed.ino
- * - Timer2 CTC 1ms ISR → 10ms/50ms flags
- * - 원샷/리핏 워크 스케줄러
+ * - 틱/슬롯 관리는 공용 코어 (core/sched_core.c, core/sched_port_avr.c 를 스케치 폴더에 복사)
+ * - Timer2 CTC 1ms ISR (sched_port_avr) → 10ms/50ms 주기 태스크 + 원샷/리핏 워크가 같은 슬롯 배열
+ * - SCHED_CYCLIC=1: 사이클릭 이그제큐티브 모드 (메이저/마이너 프레임 테이블)
+ * - SCHED_CYCLIC=2: 같은 프레임 구성을 컴파일 타임 태스크 목록으로 인라인 디스패치 (core/sched_static.hpp, C++17)
+ * - 스택리스 코루틴: 다단계 시퀀스를 워크 슬롯 1개로 실행 (CO_AWAIT_DELAY/CO_AWAIT_UNTIL)
+ * - 파워온 엣지: 고해상도 타이머 큐 (core/sched_hrt.c) — Timer2 OCR2B 비교 ISR 이 핀을 직접 씀
+ * - 출력 섀도 (core/sched_output.c): 태스크는 섀도 비트만 바꾸고 loop() 가 패스 끝에 포트당 1회 커밋
+ * - 과부하 차단 (core/sched_load.c): 루프가 밀리면 50ms 로그/ADC 출력 슬롯(사이클릭: 프레임 항목)을 솎고, 10ms ERRB 감시는 제시간
  * - Arduino 자동 프로토타입 이슈 회피 (타입/프로토타입을 최상단에 선언)
  */
 #include <Arduino.h>
 #include <stdint.h>
+#include "sched_core.h"
+#include "sched_port.h"
+#include "sched_idle.h"
+#include "sched_input.h"
+#include "sched_output.h"
+#include "sched_hrt.h"
+#include "sched_pool.h"
+#include "sched_load.h"
+#if SCHED_CYCLIC == 2
+#include "sched_static.hpp"
+#endif
 
 /* ===== 타입/프로토타입을 최상단에 둔다 ===== */
 
-/* 래핑 안전 비교 */
-static inline bool time_after_eq(uint32_t a, uint32_t b) {
-  return (int32_t)(a - b) >= 0;
-}
-
-/* 워크 스케줄러 타입들 */
+/* 워크 = 코어 슬롯 (work_t* 는 취소용 핸들) */
 typedef void (*work_fn_t)(void *arg);
-typedef enum { WORK_ONESHOT = 0, WORK_REPEAT = 1 } work_mode_t;
-
-typedef struct {
-  work_fn_t fn;
-  void*     arg;
-  uint32_t  next_due_ms;   // 만기 시각(절대)
-  uint16_t  period_ms;     // REPEAT일 때만 사용
-  uint8_t   mode;          // ONESHOT / REPEAT
-  uint8_t   active;        // 1=활성
-} work_t;
+typedef sc_task_t work_t;
 
 #ifndef WORK_CAP
 #define WORK_CAP 8
 #endif
 
+#ifndef WORK_CTX_BLOCK
+#define WORK_CTX_BLOCK 8    // 인자 컨텍스트 블록 크기 (bytes) — work_schedule_*_ctx
+#endif
+#ifndef WORK_CTX_COUNT
+#define WORK_CTX_COUNT 4    // 블록 수 (AVR RAM: WORK_CTX_BLOCK 올림 × 개수)
+#endif
+
+#define SCHED_PERIODIC_MAX 4                          // 10ms/50ms 주기 태스크 슬롯
+
+/* 과부하 감지: 주기 슬롯 지연 ≥ LATE_MS 가 ENTER 패스 연속이면 한 단계 올리고, EXIT 패스 연속 정상이면 내림 */
+#ifndef SCHED_LOAD_LATE_MS
+#define SCHED_LOAD_LATE_MS 5    // 10ms 태스크 주기의 절반
+#endif
+#ifndef SCHED_LOAD_ENTER
+#define SCHED_LOAD_ENTER   3
+#endif
+#ifndef SCHED_LOAD_EXIT
+#define SCHED_LOAD_EXIT    50   // 10ms 패스 기준 약 0.5초 정상 유지 후 복귀
+#endif
+#define SCHED_CAP (WORK_CAP + SCHED_PERIODIC_MAX)     // 코어 슬롯 수
+
+/* ===== 스택리스 코루틴 (protothread 방식) =====
+ * - 지역 변수는 yield 를 넘어 보존되지 않음 → static 또는 co_t 를 감싼 구조체에 보관
+ * - 본문에서 switch 문 사용 불가 (CO_BEGIN 이 switch 로 구현됨)
+ * - 지연은 직전 단계의 릴리즈 시각 기준 → 연속 지연이 누적 오차 없이 더해짐
+ */
+typedef struct co_s co_t;
+typedef void (*co_fn_t)(co_t* co);
+
+struct co_s {
+  co_fn_t  fn;
+  uint32_t wake_ms;   // 다음 실행 시각 (= 직전 단계 릴리즈 시각)
+  uint16_t lc;        // 재개 위치 (__LINE__), CO_LC_DONE = 종료
+};
+
+#define CO_LC_DONE 0xFFFFu
+
+#ifndef CO_POLL_MS
+#define CO_POLL_MS 1      // CO_AWAIT_UNTIL 조건 재검사 간격
+#endif
+
+#define CO_BEGIN(co)       switch ((co)->lc) { case 0:
+#define CO_END(co)         } (co)->lc = CO_LC_DONE; return
+
+/* 다음 틱에 이어서 실행 */
+#define CO_YIELD(co) \
+  do { (co)->wake_ms = g_tick_ms + 1; (co)->lc = __LINE__; return; case __LINE__:; } while (0)
+
+/* 직전 릴리즈 시각 + ms 에 재개 (슬롯은 그 시각까지 검사만 받음) */
+#define CO_AWAIT_DELAY(co, ms) \
+  do { (co)->wake_ms += (ms); (co)->lc = __LINE__; return; case __LINE__:; } while (0)
+
+/* cond 가 참이 될 때까지 CO_POLL_MS 간격으로 재검사, 성립 시각이 새 릴리즈 시각 */
+#define CO_AWAIT_UNTIL(co, cond) \
+  do { (co)->lc = __LINE__; case __LINE__: \
+       if (!(cond)) { (co)->wake_ms = g_tick_ms + CO_POLL_MS; return; } \
+       (co)->wake_ms = g_tick_ms; } while (0)
+
+/* 사이클릭 이그제큐티브 모드
+ * 0: 10ms/50ms 태스크를 코어 주기 슬롯으로 실행 (기본)
+ * 1: 10ms 마이너 프레임 × 5 = 50ms 메이저 프레임 (하이퍼피리어드) 고정 테이블
+ * 2: 1 과 같은 프레임 구성, 테이블 대신 sc_static_sched 타입 목록 (함수 포인터 없음, -std=gnu++17 필요)
+ */
+#ifndef SCHED_CYCLIC
+#define SCHED_CYCLIC 0
+#endif
+
+/* 계측: 스택 창 크기는 SC_STACK_PAINT_BYTES (sched_core.h, AVR 기본 128) */
+typedef struct {
+  sc_stats_t core;                         // 슬롯 사용 수/하이워터/등록 실패 (주기 태스크 + 워크)
+  uint16_t slot_stack[SCHED_CAP];          // 슬롯별 최대 스택 사용량 (bytes)
+#if SCHED_CYCLIC
+  uint16_t frame_stack[5];                 // 마이너 프레임별 최대 스택 사용량
+  uint16_t frame_lost;                     // 루프가 못 따라가 덮어쓴 마이너 프레임 수
+#endif
+  sc_load_stats_t load;                    // 과부하 단계/최대 지연/놓친·차단 릴리즈/진입·복귀 수
+  uint16_t ram_untouched;                  // 부팅 후 한 번도 쓰이지 않은 힙~스택 간 RAM (AVR)
+  sc_idle_t idle;                          // CPU 이용률(‰)/틱당 여유/슬립 횟수
+  sc_hrt_stats_t hrt;                      // 비교 타이머 엣지 수/최대 오차(us)
+  sc_pool_stats_t ctx;                     // 워크 컨텍스트 블록 사용 수/하이워터/실패
+} sched_stats_t;
+
 /* 전방 선언(프로토타입) — Arduino의 자동 프로토타입보다 먼저! */
-static void timer2_setup_1ms(void);
-static void work_run_due(uint32_t now_ms);
+static void sched_tick_1ms(void);
+static void sched_begin(void);
 static work_t* work_schedule_after(work_fn_t fn, void* arg, uint32_t delay_ms);
 static work_t* work_schedule_at(work_fn_t fn, void* arg, uint32_t abs_ms);
+static work_t* work_schedule_at_us(work_fn_t fn, void* arg, sc_time_t abs_us);
 static work_t* work_schedule_repeat(work_fn_t fn, void* arg, uint32_t first_after_ms, uint16_t period_ms);
+static work_t* work_schedule_after_ctx(work_fn_t fn, const void* ctx, uint8_t size, uint32_t delay_ms);
+static work_t* work_schedule_repeat_ctx(work_fn_t fn, const void* ctx, uint8_t size, uint32_t first_after_ms, uint16_t period_ms);
 static void work_cancel(work_t* w);
+static work_t* co_start(co_t* co, co_fn_t fn, uint32_t delay_ms);
+static void sched_get_stats(sched_stats_t* out);
+static void stack_paint_free_ram(void);
 
 /* 10ms/50ms 태스크 프로토타입 */
 static void t10_errb(void);
@@ -45,8 +136,7 @@ static void t50_adc(void);
 static void t50_log(void);
 
 /* 파워온/리핏 데모 콜백 프로토타입 */
-static void do_LCD_RST(void* );
-static void do_PON(void* );
+static void power_on_co(co_t* co);
 static void power_on_sequence(void);
 static void demo_repeat_cb(void* );
 static void start_demo_repeat(void);
@@ -57,105 +147,129 @@ static const uint8_t PIN_ERRB    = 2;           // D2 (INPUT_PULLUP)
 static const uint8_t PIN_LCD_RST = 4;           // D4
 static const uint8_t PIN_PON     = 5;           // D5
 
-/* ===== 공유 타임베이스 & 플래그 ===== */
+/* ===== 공유 타임베이스 & 스케줄러 인스턴스 ===== */
 volatile uint32_t g_tick_ms = 0;
+static sc_task_t  s_slots[SCHED_CAP];
+static sc_sched_t s_sched;
+static sc_idle_t  s_idle;
+static SC_POOL_STORAGE(s_ctx_mem, WORK_CTX_BLOCK, WORK_CTX_COUNT);
+static sc_pool_t  s_ctx_pool;   // 워크 인자 컨텍스트 (1회성 완료/취소 시 자동 반환)
+static sc_load_t  s_load;       // 과부하 감지기 (주기 슬롯 지연 → LOW 슬롯 차단)
+#if SCHED_CYCLIC
 static volatile uint8_t g_flag_10ms = 0;
-static volatile uint8_t g_flag_50ms = 0;
-
-/* ISR 내부 누적 카운터 */
-static uint8_t s_acc_1ms  = 0;  // 1ms → 10ms
-static uint8_t s_acc_10ms = 0;  // 10ms → 50ms (5번)
+static volatile uint8_t g_minor_frame = 0;  // 실행할 마이너 프레임 번호
+static volatile uint32_t g_frame_tick = 0;  // 첫 미실행 프레임 경계 틱 (지연 = 실행 시각 - 경계)
+static uint8_t s_acc_1ms  = 0;              // 1ms → 10ms
+static uint8_t s_acc_10ms = 0;              // 마이너 프레임 인덱스
+static uint16_t s_frame_stack[5];
+static volatile uint16_t s_frame_lost = 0;  // 이전 프레임 플래그가 남아 있는데 경계 도래
+#endif
 
-/* ===== Timer2: 1ms CTC 설정 =====
- * 16MHz / 64 = 250kHz → 1ms당 250 tick → OCR2A=249
+/* ===== 1 ms 틱 (sched_port_avr 의 Timer2 ISR 에서 호출) =====
+ * 주기 태스크는 코어가 마감 시각으로 처리하므로 10ms/50ms 플래그가 없다.
+ * 사이클릭 모드만 프레임 경계 플래그를 쓴다.
  */
-static void timer2_setup_1ms(void)
-{
-  cli();
-  TCCR2A = (1 << WGM21);           // CTC mode
-  TCCR2B = 0;
-  OCR2A  = 249;                    // TOP
-  TIMSK2 = (1 << OCIE2A);          // Interrupt on compare match
-  TCCR2B = (1 << CS22);            // prescaler = 64 (CS22=1, CS21=0, CS20=0)
-  sei();
-}
-
-/* ===== 1 ms ISR ===== */
-ISR(TIMER2_COMPA_vect)
+static void sched_tick_1ms(void)
 {
   g_tick_ms++;
+  sc_in_capture(g_tick_ms);       // 모든 입력 포트 래치 → 태스크는 스냅샷만 읽음
 
-  if (++s_acc_1ms >= 10) {        // 10ms 도래
+#if SCHED_CYCLIC
+  if (++s_acc_1ms >= 10) {        // 마이너 프레임 경계: 실행할 프레임 번호만 넘겨준다
     s_acc_1ms = 0;
+    if (g_flag_10ms) s_frame_lost++;   // 이전 프레임 미실행 → 덮어씀 (조용히 사라지지 않게 집계)
+    else g_frame_tick = g_tick_ms;     // 덮어쓸 때는 첫 미실행 경계 유지 → 지연에 밀린 프레임 포함
+    g_minor_frame = s_acc_10ms;
     g_flag_10ms = 1;
-
-    if (++s_acc_10ms >= 5) {      // 5 * 10ms = 50ms
-      s_acc_10ms = 0;
-      g_flag_50ms = 1;
-    }
+    if (++s_acc_10ms >= 5) s_acc_10ms = 0;
   }
+#endif
 }
 
-/* ===== 워크 스케줄러 구현 ===== */
-static work_t s_workq[WORK_CAP];
+/* 유휴 대기 중 깨어날 조건 (마감 외): 사이클릭 프레임 경계 */
+#if SCHED_CYCLIC
+static bool sched_pending(void) { return g_flag_10ms != 0; }
+#define SCHED_PENDING sched_pending
+#else
+#define SCHED_PENDING NULL
+#endif
+
+/* 부팅 시 힙 끝 ~ 현재 SP 사이 빈 RAM 전체를 칠해 두고, 조회 시 남은 양을 센다 */
+#if defined(__AVR__)
+extern uint8_t __heap_start;
+extern void*   __brkval;
 
-static work_t* work_alloc_slot(void) {
-  for (int i = 0; i < WORK_CAP; ++i) if (!s_workq[i].active) return &s_workq[i];
-  return NULL;
+static uint8_t* ram_free_lo(void) {
+  return __brkval ? (uint8_t*)__brkval : &__heap_start;
+}
+
+static void stack_paint_free_ram(void) {
+  uint8_t marker;
+  for (uint8_t* p = ram_free_lo(); p < &marker - 16; ++p) *p = SC_STACK_PATTERN;
+}
+
+static uint16_t ram_untouched_bytes(void) {
+  const uint8_t* p = ram_free_lo();
+  uint16_t n = 0;
+  while (p[n] == SC_STACK_PATTERN) n++;
+  return n;
+}
+#else
+static void stack_paint_free_ram(void) { }
+static uint16_t ram_untouched_bytes(void) { return 0; }
+#endif
+
+/* ===== 워크 스케줄러 (코어 래퍼) ===== */
+static work_t* work_handle(int id) {
+  return (id < 0) ? NULL : &s_slots[id];
 }
 
 static work_t* work_schedule_after(work_fn_t fn, void* arg, uint32_t delay_ms) {
-  work_t* w = work_alloc_slot();
-  if (!w) return NULL;
-  w->fn = fn;
-  w->arg = arg;
-  w->next_due_ms = (uint32_t)(g_tick_ms + delay_ms);
-  w->period_ms = 0;
-  w->mode = WORK_ONESHOT;
-  w->active = 1;
-  return w;
+  return work_handle(sc_add_at(&s_sched, fn, arg, (uint32_t)(g_tick_ms + delay_ms), 0));
 }
 
 static work_t* work_schedule_at(work_fn_t fn, void* arg, uint32_t abs_ms) {
-  work_t* w = work_alloc_slot();
-  if (!w) return NULL;
-  w->fn = fn;
-  w->arg = arg;
-  w->next_due_ms = abs_ms;
-  w->period_ms = 0;
-  w->mode = WORK_ONESHOT;
-  w->active = 1;
-  return w;
+  return work_handle(sc_add_at(&s_sched, fn, arg, abs_ms, 0));
+}
+
+static work_t* work_schedule_at_us(work_fn_t fn, void* arg, sc_time_t abs_us) {
+  return work_handle(sc_add_at_us(&s_sched, fn, arg, abs_us, 0));
 }
 
 static work_t* work_schedule_repeat(work_fn_t fn, void* arg, uint32_t first_after_ms, uint16_t period_ms) {
-  work_t* w = work_alloc_slot();
-  if (!w) return NULL;
-  w->fn = fn;
-  w->arg = arg;
-  w->next_due_ms = (uint32_t)(g_tick_ms + first_after_ms);
-  w->period_ms = period_ms;
-  w->mode = WORK_REPEAT;
-  w->active = 1;
-  return w;
-}
-
-static void work_cancel(work_t* w) { if (w) w->active = 0; }
-
-static void work_run_due(uint32_t now_ms) {
-  for (int i = 0; i < WORK_CAP; ++i) {
-    work_t* w = &s_workq[i];
-    if (!w->active) continue;
-    if (time_after_eq(now_ms, w->next_due_ms)) {
-      w->fn(w->arg);
-      if (w->mode == WORK_ONESHOT) {
-        w->active = 0;                 // 원샷: 한 번 실행하고 종료
-      } else {                         // REPEAT
-        do { w->next_due_ms += w->period_ms; }
-        while (!time_after_eq(w->next_due_ms, now_ms));
-      }
-    }
-  }
+  if (period_ms == 0) return NULL;
+  return work_handle(sc_add_at(&s_sched, fn, arg, (uint32_t)(g_tick_ms + first_after_ms), period_ms));
+}
+
+/* 인자 컨텍스트를 풀 블록에 복사해 등록 — 호출자는 ctx 를 지역 변수로 넘겨도 된다.
+ * 콜백 arg = 블록 주소. 1회성 완료 또는 work_cancel() 때 블록 자동 반환.
+ */
+static work_t* work_schedule_after_ctx(work_fn_t fn, const void* ctx, uint8_t size, uint32_t delay_ms) {
+  return work_handle(sc_add_ctx_at(&s_sched, fn, ctx, size, (uint32_t)(g_tick_ms + delay_ms), 0));
+}
+
+static work_t* work_schedule_repeat_ctx(work_fn_t fn, const void* ctx, uint8_t size, uint32_t first_after_ms, uint16_t period_ms) {
+  if (period_ms == 0) return NULL;
+  return work_handle(sc_add_ctx_at(&s_sched, fn, ctx, size, (uint32_t)(g_tick_ms + first_after_ms), period_ms));
+}
+
+static void work_cancel(work_t* w) {
+  if (w) sc_cancel(&s_sched, (int)(w - s_slots));
+}
+
+/* 코루틴 실행 트램펄린 (arg = co_t*) — 끝나지 않았으면 다음 대기 지점까지 슬롯 유지 */
+static void co_work_cb(void* arg) {
+  co_t* co = (co_t*)arg;
+  co->fn(co);
+  if (co->lc != CO_LC_DONE) sc_defer(&s_sched, co->wake_ms);
+}
+
+/* 코루틴 시작: 시퀀스 전체가 워크 슬롯 1개를 차지 */
+static work_t* co_start(co_t* co, co_fn_t fn, uint32_t delay_ms) {
+  co->fn = fn;
+  co->lc = 0;
+  co->wake_ms = (uint32_t)(g_tick_ms + delay_ms);
+  return work_handle(sc_add_at(&s_sched, co_work_cb, co, co->wake_ms, 0));
 }
 
 /* ===== 10ms 태스크들 ===== */
@@ -164,7 +278,7 @@ static void t10_errb(void) {
   static uint8_t lowCnt = 0, highCnt = 0;
   static bool fault = false;
 
-  int v = digitalRead(PIN_ERRB); // INPUT_PULLUP → 눌림=LOW
+  int v = sc_in_read_pin(PIN_ERRB); // 틱 스냅샷, INPUT_PULLUP → 눌림=LOW
   if (v == LOW) { if (lowCnt < 255) lowCnt++; highCnt = 0; }
   else          { if (highCnt < 255) highCnt++; lowCnt = 0; }
 
@@ -177,7 +291,7 @@ static void t10_led(void) {
   static uint8_t acc = 0;
   if (++acc >= 10) {
     acc = 0;
-    digitalWrite(PIN_LED, !digitalRead(PIN_LED));
+    sc_out_toggle(PIN_LED);   // 섀도 토글 — digitalRead/포트 조회 없음
   }
 }
 
@@ -205,17 +319,176 @@ static void t50_log(void) {
 }
 static const task_fn_t g_tasks_50ms[] = { t50_adc, t50_log };
 static const int TASK50_COUNT = sizeof(g_tasks_50ms)/sizeof(g_tasks_50ms[0]);
+static_assert(sizeof(g_tasks_10ms)/sizeof(g_tasks_10ms[0]) + sizeof(g_tasks_50ms)/sizeof(g_tasks_50ms[0])
+              <= SCHED_PERIODIC_MAX, "SCHED_PERIODIC_MAX");
+
+/* 주기 태스크 중요도 — 50ms 두 태스크는 출력(로그) 용이라 과부하 시 먼저 솎는다 */
+static const uint8_t g_crit_10ms[] = { SC_CRIT_HIGH, SC_CRIT_NORMAL };  // t10_errb, t10_led
+static const uint8_t g_crit_50ms[] = { SC_CRIT_LOW,  SC_CRIT_LOW };     // t50_adc, t50_log
+static_assert(sizeof(g_crit_10ms) == sizeof(g_tasks_10ms)/sizeof(g_tasks_10ms[0]), "g_crit_10ms");
+static_assert(sizeof(g_crit_50ms) == sizeof(g_tasks_50ms)/sizeof(g_tasks_50ms[0]), "g_crit_50ms");
+
+/* 스케줄러 시작: 코어 초기화 → 주기 태스크 슬롯 등록 → 1ms 틱 시작
+ * 주기 태스크의 첫 릴리즈는 주기 격자 (10ms, 50ms) 에 맞춘다.
+ */
+static void sched_begin(void)
+{
+  sc_init(&s_sched, s_slots, SCHED_CAP);
+  sc_pool_init(&s_ctx_pool, s_ctx_mem, WORK_CTX_BLOCK, WORK_CTX_COUNT);
+  sc_set_pool(&s_sched, &s_ctx_pool);
+  sc_load_init(&s_load, SCHED_LOAD_LATE_MS, SCHED_LOAD_ENTER, SCHED_LOAD_EXIT);
+#if SCHED_CYCLIC
+  sc_set_load_admit(&s_sched, &s_load);   // 지연 보고는 loop() 의 마이너 프레임 한 곳 (코어엔 데모 워크만)
+#else
+  sc_set_load(&s_sched, &s_load);
+#endif
+#if !SCHED_CYCLIC
+  uint32_t now = g_tick_ms;
+  for (int i = 0; i < TASK10_COUNT; ++i)
+    sc_set_crit(&s_sched, sc_add0_at(&s_sched, g_tasks_10ms[i], sc_next_grid(now + 1, 10), 10), g_crit_10ms[i]);
+  for (int i = 0; i < TASK50_COUNT; ++i)
+    sc_set_crit(&s_sched, sc_add0_at(&s_sched, g_tasks_50ms[i], sc_next_grid(now + 1, 50), 50), g_crit_50ms[i]);
+#endif
+  sc_port_tick_start(1, sched_tick_1ms);
+  sc_idle_init(&s_idle);
+  sc_hrt_init();
+}
+
+/* ===== 계측 조회: 한 번의 호출로 스냅샷 ===== */
+static void sched_get_stats(sched_stats_t* out)
+{
+  if (!out) return;
+  sc_get_stats(&s_sched, &out->core);
+  for (int i = 0; i < SCHED_CAP; ++i) out->slot_stack[i] = sc_task(&s_sched, i)->stack_max;
+#if SCHED_CYCLIC
+  for (int i = 0; i < 5; ++i) out->frame_stack[i] = s_frame_stack[i];
+  uint8_t st = sc_port_lock();
+  out->frame_lost = s_frame_lost;
+  sc_port_unlock(st);
+#endif
+  sc_load_get_stats(&s_load, &out->load);
+  out->ram_untouched = ram_untouched_bytes();
+  sc_idle_get(&s_idle, &out->idle);
+  sc_hrt_get_stats(&out->hrt);
+  sc_pool_get_stats(&s_ctx_pool, &out->ctx);
+}
+
+#if SCHED_CYCLIC
+/* ===== 사이클릭 이그제큐티브: 메이저 프레임 테이블 =====
+ * 메이저 프레임 = lcm(10, 50) = 50ms, 마이너 프레임 = gcd(10, 50) = 10ms → 5 프레임
+ * 50ms 태스크는 부하 평준화를 위해 서로 다른 프레임에 배치 (t50_log 는 10ms 위상 지연)
+ * 런타임은 프레임 번호로 인덱싱만 하므로 틱당 비용이 일정하고 플래그/주기 검사가 없다.
+ */
+#define CYCLIC_MINOR_MS    10
+#define CYCLIC_FRAME_COUNT 5
+
+/* 프레임 항목 = 주기 태스크 번호 (g_tasks_10ms[] 다음 g_tasks_50ms[] 순) — 중요도는 g_crit_* 그대로.
+ * 과부하 단계/중요도로 항목마다 솎고, 솎음 카운터는 태스크별 (같은 태스크가 여러 프레임에 있어도 하나)
+ */
+enum { CYC_ERRB, CYC_LED, CYC_ADC, CYC_LOG };
+static_assert(CYC_ADC == sizeof(g_tasks_10ms)/sizeof(g_tasks_10ms[0]), "cyclic task ids");
+static uint8_t s_cyc_shed[SCHED_PERIODIC_MAX];
+
+static bool cyclic_admit(uint8_t id) {
+  uint8_t crit = (id < TASK10_COUNT) ? g_crit_10ms[id] : g_crit_50ms[id - TASK10_COUNT];
+  return sc_load_admit(&s_load, crit, &s_cyc_shed[id]);
+}
+
+#if SCHED_CYCLIC == 2
+/* 프레임 구성은 주기/위상으로 선언 — 하이퍼피리어드와 프레임별 호출 목록은 컴파일러가 계산.
+ * 프레임 안의 태스크는 직접 호출(인라인)되고, 스택 계측은 프레임 단위 간접 호출 1회.
+ */
+template <void (*Fn)(void), uint8_t Id>
+static void cyclic_gated(void) {
+  if (cyclic_admit(Id)) Fn();     // Fn 은 여전히 직접 호출 (인라인)
+}
 
-/* ===== 파워온 시퀀스: 원샷 워크 ===== */
-static void do_LCD_RST(void* ) { digitalWrite(PIN_LCD_RST, HIGH); Serial.println(F("[PWR] LCD_RST=H @5ms")); }
-static void do_PON(void* )     { digitalWrite(PIN_PON,     HIGH); Serial.println(F("[PWR] PON=H @21ms")); }
+typedef sc_static_sched<CYCLIC_MINOR_MS,
+                        sc_static_task<cyclic_gated<t10_errb, CYC_ERRB>, 10>,
+                        sc_static_task<cyclic_gated<t10_led,  CYC_LED>,  10>,
+                        sc_static_task<cyclic_gated<t50_adc,  CYC_ADC>,  50>,
+                        sc_static_task<cyclic_gated<t50_log,  CYC_LOG>,  50, 10>> cyclic_static_t;
+static_assert(cyclic_static_t::frame_count == CYCLIC_FRAME_COUNT, "CYCLIC_FRAME_COUNT");
+
+static uint8_t s_static_frame;
+
+static void cyclic_static_frame(void) {
+  cyclic_static_t::run(s_static_frame);
+}
+
+static void cyclic_run_frame(uint8_t frame) {
+  s_static_frame = frame;
+  sc_call_measured(cyclic_static_frame, &s_frame_stack[frame]);
+}
+#else
+static const uint8_t g_cyclic_f0[] = { CYC_ERRB, CYC_LED, CYC_ADC };
+static const uint8_t g_cyclic_f1[] = { CYC_ERRB, CYC_LED, CYC_LOG };
+static const uint8_t g_cyclic_fn[] = { CYC_ERRB, CYC_LED };
+
+typedef struct {
+  const uint8_t* ids;
+  uint8_t        count;
+} cyclic_frame_t;
+
+#define CYCLIC_FRAME(a) { a, (uint8_t)(sizeof(a)/sizeof(a[0])) }
+static const cyclic_frame_t g_cyclic_frames[CYCLIC_FRAME_COUNT] = {
+  CYCLIC_FRAME(g_cyclic_f0),
+  CYCLIC_FRAME(g_cyclic_f1),
+  CYCLIC_FRAME(g_cyclic_fn),
+  CYCLIC_FRAME(g_cyclic_fn),
+  CYCLIC_FRAME(g_cyclic_fn),
+};
+
+static void cyclic_run_frame(uint8_t frame) {
+  const cyclic_frame_t* f = &g_cyclic_frames[frame];
+  for (uint8_t i = 0; i < f->count; ++i) {
+    uint8_t id = f->ids[i];
+    if (!cyclic_admit(id)) continue;
+    task_fn_t fn = (id < TASK10_COUNT) ? g_tasks_10ms[id] : g_tasks_50ms[id - TASK10_COUNT];
+    sc_call_measured(fn, &s_frame_stack[frame]);
+  }
+}
+#endif
+#endif
+
+/* ===== 파워온 시퀀스: 엣지는 비교 타이머 큐, 로그는 코루틴 (워크 슬롯 1개) =====
+ * 틱 슬롯으로 핀을 쓰면 엣지가 1ms 틱 + 루프 지연 안에서 흔들린다. 두 엣지를 시작 시각 기준
+ * us 마감으로 한 번에 큐에 넣으면 비교 ISR 이 제시각에 핀을 쓰고, 코루틴은 엣지 뒤에 오차만 출력한다.
+ */
+static co_t s_power_on_co;
+
+static void power_on_log(const __FlashStringHelper* msg)
+{
+  sc_hrt_stats_t st;
+  sc_hrt_get_stats(&st);
+  Serial.print(msg);
+  Serial.print(F(" err="));
+  Serial.print(st.err_last_us);
+  Serial.println(F("us"));
+}
+
+static void power_on_co(co_t* co)
+{
+  CO_BEGIN(co);
+  sc_out_write(PIN_LCD_RST, LOW);                // 두 LOW 는 같은 PORTD 쓰기로 동시에
+  sc_out_write(PIN_PON,     LOW);
+  {
+    sc_time_t t0 = sc_time_us();
+    sc_hrt_pin_at(t0 + 5000,  PIN_LCD_RST, HIGH); // 0 → 5ms
+    sc_hrt_pin_at(t0 + 21000, PIN_PON,     HIGH); // 0 → 21ms
+  }
+
+  CO_AWAIT_DELAY(co, 6);                        // LCD_RST 엣지 뒤
+  power_on_log(F("[PWR] LCD_RST=H @5ms"));
+
+  CO_AWAIT_DELAY(co, 16);                       // PON 엣지 뒤
+  power_on_log(F("[PWR] PON=H @21ms"));
+  CO_END(co);
+}
 
 static void power_on_sequence(void)
 {
-  digitalWrite(PIN_LCD_RST, LOW);
-  digitalWrite(PIN_PON,     LOW);
-  work_schedule_after(do_LCD_RST, NULL, 5);   // 5ms 후
-  work_schedule_after(do_PON,     NULL, 21);  // 21ms 후
+  co_start(&s_power_on_co, power_on_co, 0);
 }
 
 /* ===== 리핏 워크 데모 (200ms 주기) ===== */
@@ -238,32 +511,40 @@ void setup()
   digitalWrite(PIN_LED, LOW);
   digitalWrite(PIN_LCD_RST, LOW);
   digitalWrite(PIN_PON, LOW);
+  sc_out_init();          // 출력 섀도 = 현재 래치 (이후 태스크는 sc_out_*)
 
   Serial.begin(57600);
   while (!Serial) { ; }
   Serial.println(F("\n[BOOT] ultra_light_sched demo start"));
 
-  timer2_setup_1ms();     // 1ms 타이머 시작
+  stack_paint_free_ram(); // RAM 하이워터 측정용 페인트 (가장 먼저)
+
+  sched_begin();          // 코어 + 10ms/50ms 태스크 + 1ms 틱 시작
   power_on_sequence();    // 원샷 워크 데모
   start_demo_repeat();    // 리핏 워크 데모
 }
 
 void loop()
 {
-  uint32_t now = g_tick_ms;
-
-  // 1) 원샷/리핏 워크 수행 (만기 작업 실행)
-  work_run_due(now);
+  // 1) 만기 태스크 수행 (주기 태스크 + 원샷/리핏/코루틴 워크)
+  sc_run(&s_sched, g_tick_ms);
 
-  // 2) 10ms 태스크
+#if SCHED_CYCLIC
+  // 2) 현재 마이너 프레임 실행 — 경계 대비 지연을 감지기에 보고 (솎음은 프레임 항목마다)
   if (g_flag_10ms) {
+    uint8_t st = sc_port_lock();
+    uint8_t frame = g_minor_frame;
+    uint32_t at = g_frame_tick;
     g_flag_10ms = 0;
-    for (int i = 0; i < TASK10_COUNT; ++i) g_tasks_10ms[i]();
+    sc_port_unlock(st);
+    sc_load_report(&s_load, g_tick_ms - at);
+    cyclic_run_frame(frame);
   }
+#endif
 
-  // 3) 50ms 태스크
-  if (g_flag_50ms) {
-    g_flag_50ms = 0;
-    for (int i = 0; i < TASK50_COUNT; ++i) g_tasks_50ms[i]();
-  }
-}
\ No newline at end of file
+  // 3) 이번 패스에서 태스크가 바꾼 출력 핀을 포트 단위로 한 번에 반영
+  sc_out_commit();
+
+  // 4) 다음 마감(또는 프레임 경계)까지 슬립 — 그 사이 틱마다 슬롯을 다시 훑지 않음
+  sc_idle_wait(&s_idle, &s_sched, &g_tick_ms, SCHED_PENDING);
+}
@@ -0,0 +1,329 @@
+/**
+ * @file sched_core.c
+ * @brief 공용 스케줄러 코어 구현
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "sched_core.h"
+#include "sched_port.h"
+
+#define SC_F_RUNNABLE (SC_F_ACTIVE | SC_F_ENABLED)
+
+/* ===== 스택 페인팅 =====
+ * 태스크 호출 직전 현재 SP 아래 SC_STACK_PAINT_BYTES 를 패턴으로 칠하고,
+ * 호출 후 최하단부터 패턴이 남아있는 바이트 수를 세어 사용량을 구한다.
+ * (스택이 아래로 자라는 타깃 가정 — AVR/ARM/x86 공통)
+ * 칠한 창 주소는 호출자 스택에 두므로 태스크 안에서 다른 인스턴스를 돌려도 안전하다.
+ */
+#if SC_STACK_PAINT_BYTES > 0
+static __attribute__((noinline)) uintptr_t stack_paint(void) {
+  volatile uint8_t area[SC_STACK_PAINT_BYTES];
+  for (uint16_t i = 0; i < SC_STACK_PAINT_BYTES; ++i) area[i] = SC_STACK_PATTERN;
+  return (uintptr_t)area;
+}
+
+static __attribute__((noinline)) uint16_t stack_measure(uintptr_t paint_lo) {
+  const volatile uint8_t* lo = (const volatile uint8_t*)paint_lo;
+  uint16_t untouched = 0;
+  while (untouched < SC_STACK_PAINT_BYTES && lo[untouched] == SC_STACK_PATTERN) untouched++;
+  return (uint16_t)(SC_STACK_PAINT_BYTES - untouched);
+}
+#endif
+
+void sc_call_measured(sc_fn0_t fn, uint16_t* max_used) {
+#if SC_STACK_PAINT_BYTES > 0
+  uintptr_t lo = stack_paint();
+  fn();
+  uint16_t used = stack_measure(lo);
+  if (used > *max_used) *max_used = used;
+#else
+  (void)max_used;
+  fn();
+#endif
+}
+
+/* 슬롯 1개 실행 (인자 유무에 따라 호출 형태 선택) */
+static void call_task(sc_task_t* t) {
+#if SC_STACK_PAINT_BYTES > 0
+  uintptr_t lo = stack_paint();
+#endif
+  if (t->flags & SC_F_NOARG) ((sc_fn0_t)t->fn)();
+  else                       t->fn(t->arg);
+#if SC_STACK_PAINT_BYTES > 0
+  uint16_t used = stack_measure(lo);
+  if (used > t->stack_max) t->stack_max = used;
+#endif
+}
+
+/* 슬롯 반환 (ISR 의 등록과 경합하므로 잠금) — 풀 컨텍스트도 함께 반환 */
+static void free_slot(sc_sched_t* s, sc_task_t* t) {
+  uint8_t st = sc_port_lock();
+  if (t->flags & SC_F_ACTIVE) s->used--;
+  if (t->flags & SC_F_POOLED) sc_pool_free(s->pool, t->arg);
+  t->flags = 0;
+  sc_port_unlock(st);
+}
+
+/*
+ * @brief 주기 태스크 다음 릴리즈 — 위상 유지, 놓친 릴리즈는 건너뜀
+ * @return 건너뛴 릴리즈 수
+ * @note  정상 경로는 덧셈 1회, 나눗셈은 한 주기 이상 밀렸을 때만
+ */
+static uint32_t advance(sc_task_t* t, uint32_t now) {
+  t->due_ms += t->period_ms;
+  if (!sc_after_eq(now, t->due_ms)) return 0;
+  uint32_t n = (now - t->due_ms) / t->period_ms + 1;
+  t->due_ms += n * t->period_ms;
+  return n;
+}
+
+void sc_init(sc_sched_t* s, sc_task_t* slots, uint8_t cap) {
+  for (uint8_t i = 0; i < cap; ++i) {
+    slots[i].fn = NULL;
+    slots[i].arg = NULL;
+    slots[i].due_ms = 0;
+    slots[i].period_ms = 0;
+    slots[i].flags = 0;
+    slots[i].tag = i;
+    slots[i].stack_max = 0;
+    slots[i].crit = SC_CRIT_NORMAL;
+    slots[i].shed_cnt = 0;
+  }
+  s->slots = slots;
+  s->cap = cap;
+  s->used = 0;
+  s->hwm = 0;
+  s->cur = -1;
+  s->gen = 0;
+  s->alloc_fail = 0;
+  s->pool = NULL;
+  s->load = NULL;
+  s->load_report = false;
+  s->on_begin = NULL;
+  s->on_end = NULL;
+}
+
+void sc_set_hooks(sc_sched_t* s, sc_hook_fn_t on_begin, sc_hook_fn_t on_end) {
+  s->on_begin = on_begin;
+  s->on_end = on_end;
+}
+
+void sc_set_pool(sc_sched_t* s, sc_pool_t* pool) {
+  s->pool = pool;
+}
+
+void sc_set_load(sc_sched_t* s, sc_load_t* load) {
+  s->load = load;
+  s->load_report = true;
+}
+
+void sc_set_load_admit(sc_sched_t* s, sc_load_t* load) {
+  s->load = load;
+  s->load_report = false;
+}
+
+/* 빈 슬롯 확보 후 채움 — flags 를 마지막에 써서 sc_run 이 반쯤 채운 슬롯을 보지 않게 함 */
+static int add_slot(sc_sched_t* s, sc_fn_t fn, void* arg, uint32_t due_ms,
+                    uint16_t period_ms, uint8_t flags) {
+  if (!fn) return -2;
+
+  uint8_t st = sc_port_lock();
+  for (uint8_t i = 0; i < s->cap; ++i) {
+    sc_task_t* t = &s->slots[i];
+    if (t->flags & SC_F_ACTIVE) continue;
+    t->fn = fn;
+    t->arg = arg;
+    t->due_ms = due_ms;
+    t->period_ms = period_ms;
+    t->tag = i;
+    t->stack_max = 0;
+    t->crit = SC_CRIT_NORMAL;
+    t->shed_cnt = 0;
+    t->flags = (uint8_t)(SC_F_RUNNABLE | flags);
+    s->gen++;
+    if (++s->used > s->hwm) s->hwm = s->used;
+    sc_port_unlock(st);
+    return i;
+  }
+  s->alloc_fail++;
+  sc_port_unlock(st);
+  return -1;
+}
+
+int sc_add_at(sc_sched_t* s, sc_fn_t fn, void* arg, uint32_t due_ms, uint16_t period_ms) {
+  return add_slot(s, fn, arg, due_ms, period_ms, 0);
+}
+
+int sc_add0_at(sc_sched_t* s, sc_fn0_t fn, uint32_t due_ms, uint16_t period_ms) {
+  return add_slot(s, (sc_fn_t)fn, NULL, due_ms, period_ms, SC_F_NOARG);
+}
+
+int sc_add_at_us(sc_sched_t* s, sc_fn_t fn, void* arg, sc_time_t due_us, uint16_t period_ms) {
+  return add_slot(s, fn, arg, sc_time_to_tick(due_us), period_ms, 0);
+}
+
+int sc_add0_at_us(sc_sched_t* s, sc_fn0_t fn, sc_time_t due_us, uint16_t period_ms) {
+  return add_slot(s, (sc_fn_t)fn, NULL, sc_time_to_tick(due_us), period_ms, SC_F_NOARG);
+}
+
+int sc_add_ctx_at(sc_sched_t* s, sc_fn_t fn, const void* ctx, uint8_t size,
+                  uint32_t due_ms, uint16_t period_ms) {
+  if (!fn || !ctx || !s->pool || size == 0 || size > s->pool->block) return -2;
+
+  void* blk = sc_pool_alloc(s->pool);   // 실패는 풀 계측(fail)에 집계
+  if (!blk) return -1;
+  memcpy(blk, ctx, size);
+  int id = add_slot(s, fn, blk, due_ms, period_ms, SC_F_POOLED);
+  if (id < 0) sc_pool_free(s->pool, blk);
+  return id;
+}
+
+void sc_cancel(sc_sched_t* s, int id) {
+  if (id < 0 || id >= s->cap) return;
+  sc_task_t* t = &s->slots[id];
+  if (id == s->cur) {
+    // 실행 중인 자기 자신 — 콜백이 아직 arg(풀 블록)를 쥐고 있으므로 반환은 sc_run 이 호출 후에
+    uint8_t st = sc_port_lock();
+    if (t->flags & SC_F_ACTIVE) t->flags = (uint8_t)((t->flags & ~SC_F_ENABLED) | SC_F_CANCEL);
+    sc_port_unlock(st);
+    return;
+  }
+  free_slot(s, t);
+}
+
+int sc_enable(sc_sched_t* s, int id, bool enable, uint32_t now) {
+  if (id < 0 || id >= s->cap) return -1;
+  sc_task_t* t = &s->slots[id];
+  if ((t->flags & (SC_F_ACTIVE | SC_F_CANCEL)) != SC_F_ACTIVE) return -1;
+
+  if (!enable) {
+    t->flags &= (uint8_t)~SC_F_ENABLED;
+  } else if (!(t->flags & SC_F_ENABLED)) {
+    // 중지 동안 지난 릴리즈는 실행하지 않고 다음 위상부터
+    if (t->period_ms && sc_after_eq(now, t->due_ms)) {
+      uint32_t late = now - t->due_ms;
+      t->due_ms += (late / t->period_ms + 1) * t->period_ms;
+    }
+    t->flags |= SC_F_ENABLED;
+    s->gen++;
+  }
+  return 0;
+}
+
+void sc_set_tag(sc_sched_t* s, int id, uint8_t tag) {
+  if (id < 0 || id >= s->cap) return;
+  s->slots[id].tag = tag;
+}
+
+int sc_set_crit(sc_sched_t* s, int id, uint8_t crit) {
+  if (id < 0 || id >= s->cap) return -1;
+  if (crit > SC_CRIT_HIGH) return -2;
+  sc_task_t* t = &s->slots[id];
+  if (!(t->flags & SC_F_ACTIVE)) return -1;
+  t->crit = crit;
+  t->shed_cnt = 0;
+  return 0;
+}
+
+int sc_defer(sc_sched_t* s, uint32_t due_ms) {
+  if (s->cur < 0) return -1;
+  sc_task_t* t = &s->slots[s->cur];
+  t->due_ms = due_ms;
+  t->flags |= SC_F_DEFER;
+  return 0;
+}
+
+uint8_t sc_run(sc_sched_t* s, uint32_t now) {
+  uint8_t ran = 0;
+  sc_load_t* load = s->load;
+  bool released = false;   // 이번 패스에 주기 릴리즈가 있었음 → 지연 보고
+  uint32_t late_max = 0;
+
+  for (uint8_t i = 0; i < s->cap; ++i) {
+    sc_task_t* t = &s->slots[i];
+    if ((t->flags & SC_F_RUNNABLE) != SC_F_RUNNABLE) continue;
+    if (!sc_after_eq(now, t->due_ms)) continue;
+
+    if (load && t->period_ms) {
+      uint32_t late = now - t->due_ms;
+      if (late > late_max) late_max = late;
+      released = true;
+      uint8_t cnt = t->shed_cnt;
+      bool run = sc_load_admit(load, t->crit, &cnt);
+      t->shed_cnt = cnt;
+      if (!run) {                                 // 차단: 실행 없이 다음 위상으로
+        load->missed += advance(t, now);
+        continue;
+      }
+    }
+
+    uint8_t tag = t->tag;
+    s->cur = (int8_t)i;
+    if (s->on_begin) s->on_begin(tag);
+    call_task(t);
+    if (s->on_end) s->on_end(tag);
+    s->cur = -1;
+    ran++;
+
+    if (t->flags & SC_F_CANCEL) {             // 실행 중 스스로 해제됨 → 이제 반환
+      free_slot(s, t);
+      continue;
+    }
+    if (t->period_ms) {
+      uint32_t missed = advance(t, now);
+      if (load) load->missed += missed;
+    } else if (t->flags & SC_F_DEFER) {       // 1회성이지만 다음 대기 지점까지 유지
+      t->flags &= (uint8_t)~SC_F_DEFER;
+    } else {
+      free_slot(s, t);
+    }
+  }
+  if (released && s->load_report) sc_load_report(load, late_max);
+  return ran;
+}
+
+bool sc_next_due(const sc_sched_t* s, uint32_t now, uint32_t* due_ms) {
+  bool found = false;
+  uint32_t best = 0;   // now 기준 남은 시간 (만기 지남 = 0)
+  for (uint8_t i = 0; i < s->cap; ++i) {
+    const sc_task_t* t = &s->slots[i];
+    if ((t->flags & SC_F_RUNNABLE) != SC_F_RUNNABLE) continue;
+    uint32_t ahead = sc_after_eq(now, t->due_ms) ? 0 : t->due_ms - now;
+    if (!found || ahead < best) best = ahead;
+    found = true;
+  }
+  if (found) *due_ms = now + best;
+  return found;
+}
+
+void sc_align(sc_sched_t* s, uint32_t now, uint16_t grid) {
+  for (uint8_t i = 0; i < s->cap; ++i) {
+    sc_task_t* t = &s->slots[i];
+    if (!(t->flags & SC_F_ACTIVE)) continue;
+    uint32_t ahead = t->due_ms - now;
+    if ((int32_t)ahead <= 0) continue;  // 이미 만기 — 다음 틱에 실행
+    ahead = (ahead + grid - 1) / grid * grid;
+    t->due_ms = now + ahead;
+  }
+}
+
+uint32_t sc_next_grid(uint32_t now, uint16_t grid) {
+  uint32_t rem = now % grid;
+  return rem ? now + (grid - rem) : now;
+}
+
+void sc_get_stats(const sc_sched_t* s, sc_stats_t* out) {
+  if (!out) return;
+  uint8_t st = sc_port_lock();
+  out->used = s->used;
+  out->hwm = s->hwm;
+  out->cap = s->cap;
+  out->alloc_fail = s->alloc_fail;
+  sc_port_unlock(st);
+}
+
+const sc_task_t* sc_task(const sc_sched_t* s, int id) {
+  if (id < 0 || id >= s->cap) return NULL;
+  return &s->slots[id];
+}
@@ -0,0 +1,260 @@
+/**
+ * @file sched_core.h
+ * @brief 공용 스케줄러 코어 (InputTestC/sch.c, Schedulartest.ino, 드라이버 매니저 공용)
+ * @details 주기/1회성/드라이버 태스크를 하나의 슬롯 구조(sc_task_t)로 관리한다.
+ *          - 인스턴스(sc_sched_t)는 호출자가 준 슬롯 배열을 쓴다 → 동적 할당 없음
+ *          - period_ms = 0 이면 1회성: 실행 후 슬롯 반환 (실행 중 sc_defer() 로 연장 가능)
+ *          - 주기 태스크는 릴리즈 위상을 유지하고, 놓친 릴리즈는 건너뛴다 (몰아서 실행 안 함)
+ *          - 틱 소스/인터럽트 잠금은 sched_port.h 포트 계층이 제공
+ *          - 시각은 32비트 틱(ms). 64비트 us 마감은 sc_add_at_us() 가 틱으로 변환 (sched_time.h)
+ *          - 인자 컨텍스트는 sc_add_ctx_at() 이 풀 블록(sched_pool.h)에 복사하고 슬롯 반환 시 함께 반환
+ *          - 감지기(sched_load.h)를 붙이면 주기 태스크 지연을 보고하고, 과부하 시 중요도 낮은 슬롯을 솎음
+ *
+ *          순수 C — Arduino 에서는 core/ 파일을 스케치 폴더에 함께 복사한다.
+ */
+#ifndef SCHED_CORE_H
+#define SCHED_CORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sched_time.h"
+#include "sched_pool.h"
+#include "sched_load.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===== 스택 계측 ===== */
+#ifndef SC_STACK_PAINT_BYTES
+#if defined(__AVR__)
+#define SC_STACK_PAINT_BYTES 128    ///< 태스크 호출 직전 칠하는 스택 창 크기 (0 = 비활성)
+#else
+#define SC_STACK_PAINT_BYTES 4096
+#endif
+#endif
+#define SC_STACK_PATTERN 0xA5
+
+/* ===== 슬롯 플래그 ===== */
+#define SC_F_ACTIVE   0x01  ///< 슬롯 사용 중
+#define SC_F_ENABLED  0x02  ///< 만기 시 실행 (해제 시 만기 검사만 건너뜀)
+#define SC_F_NOARG    0x04  ///< fn 이 void(void) — 인자 없이 호출
+#define SC_F_DEFER    0x08  ///< 실행 중 sc_defer() 호출됨 (내부용)
+#define SC_F_POOLED   0x10  ///< arg 가 풀 블록 — 슬롯 반환 시 풀에 반환 (내부용)
+#define SC_F_CANCEL   0x20  ///< 실행 중 자기 해제 — 콜백 반환 후 sc_run 이 반환 (내부용)
+
+typedef void (*sc_fn_t)(void* arg);
+typedef void (*sc_fn0_t)(void);
+
+/**
+ * @brief 태스크 시작/종료 훅 (트레이스, 예산 감시 연동)
+ * @param tag 슬롯 태그 (기본 = 슬롯 인덱스, sc_set_tag() 로 변경)
+ */
+typedef void (*sc_hook_fn_t)(uint8_t tag);
+
+/**
+ * @brief 태스크 슬롯
+ */
+typedef struct {
+  sc_fn_t  fn;
+  void*    arg;
+  uint32_t due_ms;      ///< 다음 릴리즈 시각 (절대)
+  uint16_t period_ms;   ///< 0 = 1회성
+  uint8_t  flags;       ///< SC_F_xxx
+  uint8_t  tag;         ///< 훅에 전달되는 ID
+  uint16_t stack_max;   ///< 최대 스택 사용량 (bytes, SC_STACK_PAINT_BYTES 면 창 초과)
+  uint8_t  crit     : 2;  ///< SC_CRIT_xxx (기본 NORMAL)
+  uint8_t  shed_cnt : 6;  ///< 솎음 카운터 (내부용, SC_LOAD_DECIM ≤ 64)
+} sc_task_t;
+
+/**
+ * @brief 스케줄러 인스턴스
+ */
+typedef struct {
+  sc_task_t*   slots;
+  uint8_t      cap;
+  uint8_t      used;        ///< 현재 사용 중인 슬롯 수
+  uint8_t      hwm;         ///< 최대 동시 사용 수
+  int8_t       cur;         ///< 실행 중인 슬롯 (-1 = 없음)
+  volatile uint8_t gen;     ///< 등록/재개 시 증가 — 대기 중 새 일감 감지용 (sched_idle)
+  uint16_t     alloc_fail;  ///< 슬롯 부족으로 등록 실패한 횟수
+  sc_pool_t*   pool;        ///< sc_add_ctx_at() 컨텍스트 풀 (NULL = 미사용)
+  sc_load_t*   load;        ///< 과부하 감지기 (NULL = 차단 없음)
+  bool         load_report; ///< sc_run() 이 지연을 감지기에 보고 (false = 솎음 판정만)
+  sc_hook_fn_t on_begin;
+  sc_hook_fn_t on_end;
+} sc_sched_t;
+
+/**
+ * @brief 계측 스냅샷
+ */
+typedef struct {
+  uint8_t  used;
+  uint8_t  hwm;
+  uint8_t  cap;
+  uint16_t alloc_fail;
+} sc_stats_t;
+
+/* ===== 오버플로 안전 비교 (a 가 b 이후 또는 동일이면 true) ===== */
+static inline bool sc_after_eq(uint32_t a, uint32_t b) {
+  return (int32_t)(a - b) >= 0;
+}
+
+/**
+ * @brief 인스턴스 초기화 (모든 슬롯 비움, 훅 해제)
+ * @param s     인스턴스
+ * @param slots 슬롯 배열
+ * @param cap   슬롯 수 (최대 127)
+ */
+void sc_init(sc_sched_t* s, sc_task_t* slots, uint8_t cap);
+
+/**
+ * @brief 태스크 시작/종료 훅 설정 (NULL = 없음)
+ */
+void sc_set_hooks(sc_sched_t* s, sc_hook_fn_t on_begin, sc_hook_fn_t on_end);
+
+/**
+ * @brief 컨텍스트 풀 연결 (sc_add_ctx_at() 용, NULL = 해제)
+ * @note  인스턴스 하나에 풀 하나. 같은 풀을 여러 인스턴스가 공유해도 된다.
+ */
+void sc_set_pool(sc_sched_t* s, sc_pool_t* pool);
+
+/**
+ * @brief 과부하 감지기 연결 (NULL = 해제)
+ * @details 연결하면 sc_run() 이 주기 태스크 릴리즈가 있던 패스마다 최대 지연(now - 마감)을
+ *          sc_load_report() 로 보고하고, 감지기 단계와 슬롯 중요도로 릴리즈를 솎는다.
+ */
+void sc_set_load(sc_sched_t* s, sc_load_t* load);
+
+/**
+ * @brief 과부하 감지기를 솎음 판정에만 연결 (지연 보고 없음, NULL = 해제)
+ * @details 지연을 다른 곳(틱 ISR 초과, 프레임 경계 지연)에서 보고할 때 쓴다. 감지기는 연속 지연
+ *          보고로 단계를 올리므로 보고자가 둘이면 한쪽의 정상 보고가 다른 쪽의 연속을 끊는다.
+ */
+void sc_set_load_admit(sc_sched_t* s, sc_load_t* load);
+
+/**
+ * @brief 태스크 등록 (절대 시각)
+ * @param s         인스턴스
+ * @param fn        태스크 함수
+ * @param arg       인자
+ * @param due_ms    최초 릴리즈 시각 (절대)
+ * @param period_ms 반복 주기 (0 = 1회성)
+ * @return 슬롯 ID (0 이상), -1: 슬롯 부족, -2: 잘못된 파라미터
+ * @note  ISR 에서 호출 가능
+ */
+int sc_add_at(sc_sched_t* s, sc_fn_t fn, void* arg, uint32_t due_ms, uint16_t period_ms);
+
+/**
+ * @brief 인자 없는 태스크 등록 (void(void) 함수, 절대 시각)
+ * @return sc_add_at() 과 같음
+ */
+int sc_add0_at(sc_sched_t* s, sc_fn0_t fn, uint32_t due_ms, uint16_t period_ms);
+
+/**
+ * @brief 태스크 등록 (64비트 us 마감)
+ * @param due_us    최초 릴리즈 시각 (sc_time_us() 기준) — 그 이후 첫 틱에 실행
+ * @param period_ms 반복 주기 (0 = 1회성)
+ * @return sc_add_at() 과 같음
+ * @note  틱 카운터가 sc_port_tick_start() 와 함께 0 에서 시작하는 인스턴스용
+ */
+int sc_add_at_us(sc_sched_t* s, sc_fn_t fn, void* arg, sc_time_t due_us, uint16_t period_ms);
+
+/**
+ * @brief 인자 없는 태스크 등록 (64비트 us 마감)
+ */
+int sc_add0_at_us(sc_sched_t* s, sc_fn0_t fn, sc_time_t due_us, uint16_t period_ms);
+
+/**
+ * @brief 인자 컨텍스트를 복사해 태스크 등록 (절대 시각)
+ * @param ctx  복사할 컨텍스트 — 풀 블록에 size 바이트 복사, fn 에는 블록 주소가 전달됨
+ * @param size 컨텍스트 크기 (1 ~ 풀 블록 크기)
+ * @return 슬롯 ID (0 이상), -1: 슬롯 또는 풀 블록 부족, -2: 잘못된 파라미터 (풀 없음 포함)
+ * @note  블록은 1회성 실행 완료 또는 sc_cancel() 때 자동 반환 — 그 뒤 블록 주소 사용 금지.
+ *        반복 태스크는 호출 사이에 블록 내용이 유지되므로 상태 저장에도 쓸 수 있다.
+ *        ISR 에서 호출 가능
+ */
+int sc_add_ctx_at(sc_sched_t* s, sc_fn_t fn, const void* ctx, uint8_t size,
+                  uint32_t due_ms, uint16_t period_ms);
+
+/**
+ * @brief 등록 해제 (실행 중인 자기 자신도 가능)
+ * @note  sc_add_ctx_at() 슬롯은 컨텍스트 블록도 반환.
+ *        실행 중인 자기 자신이면 실행만 막고, 슬롯/블록은 콜백이 돌아온 뒤 반환 —
+ *        콜백은 해제 후에도 arg 를 쓰고 새 워크를 등록해도 된다 (같은 슬롯을 재사용하지 않음)
+ */
+void sc_cancel(sc_sched_t* s, int id);
+
+/**
+ * @brief 실행 허용/중지 (슬롯은 유지)
+ * @param now 현재 틱 — 재개 시 지난 릴리즈를 건너뛰고 다음 위상으로 맞춤
+ * @return 0: 성공, -1: 비활성 슬롯
+ */
+int sc_enable(sc_sched_t* s, int id, bool enable, uint32_t now);
+
+/**
+ * @brief 훅 태그 변경
+ */
+void sc_set_tag(sc_sched_t* s, int id, uint8_t tag);
+
+/**
+ * @brief 슬롯 중요도 설정 (등록 기본값 SC_CRIT_NORMAL)
+ * @param crit SC_CRIT_LOW / SC_CRIT_NORMAL / SC_CRIT_HIGH
+ * @return 0: 성공, -1: 비활성 슬롯, -2: 잘못된 중요도
+ * @note  주기 슬롯에만 의미 있음 — 1회성은 차단하지 않는다
+ */
+int sc_set_crit(sc_sched_t* s, int id, uint8_t crit);
+
+/**
+ * @brief 실행 중인 1회성 태스크를 due_ms 에 다시 실행 (슬롯 유지)
+ * @return 0: 성공, -1: 실행 중인 태스크 없음
+ * @note  태스크 본문에서만 호출 — 코루틴이 다음 대기 지점까지 슬롯을 붙잡는 데 사용
+ */
+int sc_defer(sc_sched_t* s, uint32_t due_ms);
+
+/**
+ * @brief 만기 태스크 실행
+ * @param now 현재 틱
+ * @return 실행한 태스크 수
+ */
+uint8_t sc_run(sc_sched_t* s, uint32_t now);
+
+/**
+ * @brief 가장 이른 마감 시각 조회 (실행 가능한 슬롯 중)
+ * @param now    현재 틱 — 래핑 비교 기준
+ * @param due_ms 결과 (반환값 true 일 때만 유효)
+ * @return false: 대기 중인 태스크 없음
+ */
+bool sc_next_due(const sc_sched_t* s, uint32_t now, uint32_t* due_ms);
+
+/**
+ * @brief 대기 중인 마감 시각을 grid 격자로 올림 정렬 (틱 해상도 변경 시)
+ */
+void sc_align(sc_sched_t* s, uint32_t now, uint16_t grid);
+
+/**
+ * @brief now 이후(포함) 첫 grid 배수 시각
+ */
+uint32_t sc_next_grid(uint32_t now, uint16_t grid);
+
+/**
+ * @brief 계측 값 조회
+ */
+void sc_get_stats(const sc_sched_t* s, sc_stats_t* out);
+
+/**
+ * @brief 슬롯 조회
+ * @return 슬롯 (읽기 전용), 범위 밖이면 NULL
+ */
+const sc_task_t* sc_task(const sc_sched_t* s, int id);
+
+/**
+ * @brief 함수 호출 + 스택 사용량 최대값 갱신 (코어 밖 디스패처용 — 정적 테이블, 사이클릭 프레임)
+ */
+void sc_call_measured(sc_fn0_t fn, uint16_t* max_used);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_CORE_H
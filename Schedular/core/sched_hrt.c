@@ -0,0 +1,151 @@
+/**
+ * @file sched_hrt.c
+ * @brief 고해상도 1회성 타이머 큐 구현
+ */
+
+#include <stddef.h>
+#include "sched_hrt.h"
+#include "sched_port.h"
+#include "sched_output.h"
+
+#define HRT_NONE (-1)
+
+typedef struct {
+  sc_time_t due_us;
+  sc_fn_t   fn;       ///< NULL = 핀 동작
+  void*     arg;
+  int8_t    next;     ///< 마감 순 다음 항목 (HRT_NONE = 끝)
+  uint8_t   pin;
+  uint8_t   level;
+  uint8_t   used;
+} hrt_ent_t;
+
+static hrt_ent_t      s_q[SC_HRT_CAP];
+static int8_t         s_head = HRT_NONE;   // 가장 이른 마감
+static sc_hrt_stats_t s_stats;
+
+/*
+ * 만기 항목 실행 후 다음 항목으로 비교 타이머 설정 (잠금 상태 / 비교 ISR)
+ * 시각을 동작 직전에 읽어 오차로 기록한다. 핀 동작이 기록보다 먼저 — 엣지 지연 최소화.
+ */
+static void service_locked(void)
+{
+  for (;;) {
+    if (s_head == HRT_NONE) {
+      sc_port_hrt_disarm();
+      return;
+    }
+    hrt_ent_t* e = &s_q[s_head];
+    sc_time_t now = sc_port_time_us();
+    if (e->due_us > now) {
+      if (sc_port_hrt_arm(e->due_us)) return;
+      continue;   // 설정하는 사이 지남 → 바로 처리
+    }
+
+    sc_time_t due = e->due_us;   // 슬롯을 먼저 반환 — 콜백이 같은 슬롯에 다시 등록할 수 있음
+    s_head = e->next;
+    e->used = 0;
+    if (e->fn) e->fn(e->arg);
+    else {
+      sc_port_pin_write(e->pin, e->level);
+      sc_out_note(e->pin, e->level);   // 섀도 기준 sc_out_level()/toggle() 이 실제 레벨을 보도록
+    }
+
+    uint32_t err = (uint32_t)(now - due);
+    s_stats.fired++;
+    s_stats.err_last_us = err;
+    if (err > s_stats.err_max_us) s_stats.err_max_us = err;
+  }
+}
+
+/* 비교 ISR 진입점 */
+static void on_match(void)
+{
+  service_locked();
+}
+
+void sc_hrt_init(void)
+{
+  uint8_t st = sc_port_lock();
+  for (uint8_t i = 0; i < SC_HRT_CAP; ++i) s_q[i].used = 0;
+  s_head = HRT_NONE;
+  s_stats.fired = 0;
+  s_stats.full = 0;
+  s_stats.past = 0;
+  s_stats.err_last_us = 0;
+  s_stats.err_max_us = 0;
+  sc_port_hrt_init(on_match);
+  sc_port_hrt_disarm();
+  sc_port_unlock(st);
+}
+
+static int insert(sc_time_t due_us, sc_fn_t fn, void* arg, uint8_t pin, uint8_t level)
+{
+  uint8_t st = sc_port_lock();
+  int8_t id = HRT_NONE;
+  for (uint8_t i = 0; i < SC_HRT_CAP; ++i) {
+    if (!s_q[i].used) { id = (int8_t)i; break; }
+  }
+  if (id == HRT_NONE) {
+    s_stats.full++;
+    sc_port_unlock(st);
+    return -1;
+  }
+
+  hrt_ent_t* e = &s_q[id];
+  e->due_us = due_us;
+  e->fn = fn;
+  e->arg = arg;
+  e->pin = pin;
+  e->level = level;
+  e->used = 1;
+
+  // 같은 마감은 등록 순서대로
+  int8_t* link = &s_head;
+  while (*link != HRT_NONE && s_q[*link].due_us <= due_us) link = &s_q[*link].next;
+  e->next = *link;
+  *link = id;
+
+  if (s_head == id) {   // 가장 이른 항목이 바뀜 → 비교 타이머 재설정 (지난 마감이면 여기서 실행)
+    if (due_us <= sc_port_time_us()) s_stats.past++;
+    service_locked();
+  }
+  sc_port_unlock(st);
+  return id;
+}
+
+int sc_hrt_call_at(sc_time_t due_us, sc_fn_t fn, void* arg)
+{
+  if (!fn) return -2;
+  return insert(due_us, fn, arg, 0, 0);
+}
+
+int sc_hrt_pin_at(sc_time_t due_us, uint8_t pin, uint8_t level)
+{
+  return insert(due_us, NULL, NULL, pin, level ? 1 : 0);
+}
+
+int sc_hrt_cancel(int id)
+{
+  if (id < 0 || id >= SC_HRT_CAP) return -1;
+  uint8_t st = sc_port_lock();
+  if (!s_q[id].used) {
+    sc_port_unlock(st);
+    return -1;
+  }
+  int8_t* link = &s_head;
+  while (*link != id) link = &s_q[*link].next;
+  *link = s_q[id].next;
+  s_q[id].used = 0;
+  if (link == &s_head) service_locked();   // 맨 앞을 뺐으면 다음 항목으로
+  sc_port_unlock(st);
+  return 0;
+}
+
+void sc_hrt_get_stats(sc_hrt_stats_t* out)
+{
+  if (!out) return;
+  uint8_t st = sc_port_lock();
+  *out = s_stats;
+  sc_port_unlock(st);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file sched_hrt.h
+ * @brief 고해상도 1회성 타이머 큐 — 비교 타이머 ISR 에서 콜백/핀 동작
+ * @details 틱 스케줄러(sc_run)는 만기를 틱 경계에서, 메인 루프가 돌 때 처리하므로 엣지가
+ *          틱 1개 + 루프 지연 안 어딘가에 떨어진다. 전원 시퀀스처럼 엣지 시각 자체가 사양인
+ *          동작은 이 큐에 넣는다.
+ *          - 마감(sc_time_us() 기준 us) 순 연결 리스트, 가장 이른 항목으로 포트 비교 타이머 설정
+ *            (sc_port_hrt_arm — AVR Timer2 OCR2B 4us, RP2040 하드웨어 알람 1us)
+ *          - 비교 ISR 이 만기 항목을 꺼내 핀 동작(sc_port_pin_write + 출력 섀도 sc_out_note) 또는 콜백을 바로 실행하고
+ *            다음 항목으로 다시 설정 → 전역 틱 주기는 그대로
+ *          - 실행 시각 - 마감 = 엣지 오차 (계측: sc_hrt_get_stats)
+ *
+ *          콜백은 ISR 컨텍스트 — 짧게, 블로킹 금지. 긴 후처리는 sc_add_at() 로 넘긴다.
+ */
+#ifndef SCHED_HRT_H
+#define SCHED_HRT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sched_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SC_HRT_CAP
+#define SC_HRT_CAP 8   ///< 동시에 대기할 수 있는 항목 수
+#endif
+
+/**
+ * @brief 엣지 오차 계측
+ */
+typedef struct {
+  uint16_t fired;         ///< 실행한 항목 수
+  uint16_t full;          ///< 큐가 차서 등록 실패한 횟수
+  uint16_t past;          ///< 등록 시 이미 지난 마감 (즉시 실행)
+  uint32_t err_last_us;   ///< 마지막 항목 실행 시각 - 마감
+  uint32_t err_max_us;    ///< 최대 오차
+} sc_hrt_stats_t;
+
+/**
+ * @brief 큐 초기화 + 포트 비교 타이머 연결 (sc_port_tick_start() 이후)
+ */
+void sc_hrt_init(void);
+
+/**
+ * @brief due_us 에 콜백 1회 (비교 ISR 에서)
+ * @return 항목 ID (0 이상), -1: 큐 가득, -2: 잘못된 파라미터
+ * @note  이미 지난 마감은 이 호출 안에서 바로 실행된다
+ */
+int sc_hrt_call_at(sc_time_t due_us, sc_fn_t fn, void* arg);
+
+/**
+ * @brief due_us 에 출력 핀 레벨 변경 1회 (비교 ISR 에서 포트 레지스터 직접 쓰기)
+ * @return sc_hrt_call_at() 과 같음
+ */
+int sc_hrt_pin_at(sc_time_t due_us, uint8_t pin, uint8_t level);
+
+/**
+ * @brief 대기 중인 항목 취소
+ * @return 0: 성공, -1: 이미 실행/취소됨
+ */
+int sc_hrt_cancel(int id);
+
+/**
+ * @brief 계측 값 조회
+ */
+void sc_hrt_get_stats(sc_hrt_stats_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_HRT_H
@@ -0,0 +1,84 @@
+/**
+ * @file sched_idle.c
+ * @brief 유휴 관리자 구현
+ */
+
+#include <stddef.h>
+#include "sched_idle.h"
+#include "sched_port.h"
+
+void sc_idle_init(sc_idle_t* id) {
+  id->mark_us = sc_port_us();
+  id->win_busy_us = 0;
+  id->win_idle_us = 0;
+  id->util_permille = 0;
+  id->util_peak = 0;
+  id->slack_last_us = 0;
+  id->slack_min_us = UINT32_MAX;
+  id->sleeps_light = 0;
+  id->sleeps_deep = 0;
+}
+
+static uint8_t pick_level(uint32_t now_ms, bool has_due, uint32_t due_ms) {
+  if (!has_due) return SC_SLEEP_DEEP;
+  return (due_ms - now_ms >= SC_IDLE_DEEP_MS) ? SC_SLEEP_DEEP : SC_SLEEP_LIGHT;
+}
+
+/* 창 마감: 이용률 확정 후 누적 초기화 */
+static void close_window(sc_idle_t* id) {
+  uint32_t total = id->win_busy_us + id->win_idle_us;
+  if (total < SC_IDLE_WINDOW_US) return;
+  id->util_permille = (uint16_t)((uint64_t)id->win_busy_us * 1000u / total);
+  if (id->util_permille > id->util_peak) id->util_peak = id->util_permille;
+  id->win_busy_us = 0;
+  id->win_idle_us = 0;
+}
+
+/* 잠금 상태에서 호출 — 슬립 후 잠금 해제된 상태로 돌아옴 */
+static void sleep_locked(sc_idle_t* id, uint8_t st, uint8_t level) {
+  uint32_t t0 = sc_port_us();
+  id->win_busy_us += t0 - id->mark_us;
+  if (level == SC_SLEEP_DEEP) id->sleeps_deep++;
+  else                        id->sleeps_light++;
+
+  sc_port_sleep(st, level);
+
+  uint32_t t1 = sc_port_us();
+  uint32_t slept = t1 - t0;
+  id->win_idle_us += slept;
+  id->slack_last_us = slept;
+  if (slept < id->slack_min_us) id->slack_min_us = slept;
+  id->mark_us = t1;
+  close_window(id);
+}
+
+void sc_idle_sleep(sc_idle_t* id, uint32_t now_ms, bool has_due, uint32_t due_ms) {
+  uint8_t st = sc_port_lock();
+  sleep_locked(id, st, pick_level(now_ms, has_due, due_ms));
+}
+
+uint16_t sc_idle_wait(sc_idle_t* id, sc_sched_t* s, const volatile uint32_t* tick_ms,
+                      sc_idle_pending_fn_t pending) {
+  uint8_t gen = s->gen;
+  uint32_t due = 0;
+  bool has_due = sc_next_due(s, *tick_ms, &due);
+  uint16_t n = 0;
+
+  for (;;) {
+    uint8_t st = sc_port_lock();
+    uint32_t now = *tick_ms;
+    if (s->gen != gen || (has_due && sc_after_eq(now, due)) || (pending && pending())) {
+      sc_port_unlock(st);
+      return n;
+    }
+    sleep_locked(id, st, pick_level(now, has_due, due));
+    n++;
+  }
+}
+
+void sc_idle_get(const sc_idle_t* id, sc_idle_t* out) {
+  if (!out) return;
+  uint8_t st = sc_port_lock();
+  *out = *id;
+  sc_port_unlock(st);
+}
@@ -0,0 +1,86 @@
+/**
+ * @file sched_idle.h
+ * @brief 유휴 관리자 — 다음 마감까지 슬립 + 틱당 여유(slack)/CPU 이용률 계측
+ * @details 메인 루프가 할 일이 없을 때 플래그를 계속 폴링하는 대신,
+ *          다음 마감(sc_next_due)과 대기 작업 유무로 슬립 단계를 고르고 포트 계층으로 잠든다.
+ *          - 대기 작업 있음          → 슬립하지 않음
+ *          - 마감이 SC_IDLE_DEEP_MS 미만 → SC_SLEEP_LIGHT
+ *          - 마감 없음/충분히 멀리    → SC_SLEEP_DEEP
+ *          깨어날 때마다 잠든 시간을 그 틱의 여유로 기록하고, 실행/유휴 시간을
+ *          SC_IDLE_WINDOW_US 창으로 모아 CPU 이용률(‰)을 낸다.
+ */
+#ifndef SCHED_IDLE_H
+#define SCHED_IDLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sched_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SC_IDLE_DEEP_MS
+#define SC_IDLE_DEEP_MS   10UL        ///< 다음 마감이 이만큼 이상 남으면 깊은 슬립
+#endif
+#ifndef SC_IDLE_WINDOW_US
+#define SC_IDLE_WINDOW_US 1000000UL   ///< 이용률 집계 창 (us)
+#endif
+
+/**
+ * @brief 대기 작업 확인 콜백 (예: 사이클릭 프레임 플래그, 수신 버퍼)
+ * @return true: 슬립하지 말고 메인 루프로 돌아감
+ * @note  인터럽트 잠금 상태에서 호출되므로 짧게 유지
+ */
+typedef bool (*sc_idle_pending_fn_t)(void);
+
+/**
+ * @brief 유휴 관리자 상태 (호출자 소유, 정적 할당)
+ */
+typedef struct {
+  uint32_t mark_us;        ///< 마지막으로 깨어난 시각
+  uint32_t win_busy_us;    ///< 현재 창 실행 시간
+  uint32_t win_idle_us;    ///< 현재 창 슬립 시간
+  uint16_t util_permille;  ///< 직전 창 CPU 이용률 (‰)
+  uint16_t util_peak;      ///< 창 단위 최대 이용률 (‰)
+  uint32_t slack_last_us;  ///< 마지막 틱 여유
+  uint32_t slack_min_us;   ///< 최소 틱 여유 (최악)
+  uint32_t sleeps_light;   ///< SC_SLEEP_LIGHT 진입 횟수
+  uint32_t sleeps_deep;    ///< SC_SLEEP_DEEP 진입 횟수
+} sc_idle_t;
+
+/**
+ * @brief 상태 초기화 (계측 시작 시각 = 지금)
+ */
+void sc_idle_init(sc_idle_t* id);
+
+/**
+ * @brief 1회 슬립 (다음 인터럽트까지)
+ * @param now_ms  현재 틱
+ * @param has_due false 면 대기 중인 마감 없음
+ * @param due_ms  다음 마감 — 슬립 단계 결정에만 사용
+ * @note  틱 ISR 이 일을 직접 처리하는 디스패처(sch.c)용: 매 틱 1회 호출
+ */
+void sc_idle_sleep(sc_idle_t* id, uint32_t now_ms, bool has_due, uint32_t due_ms);
+
+/**
+ * @brief 다음 마감까지 대기 (메인 루프 디스패처용)
+ * @param s       스케줄러 — 마감 조회 1회, 대기 중 등록/재개(s->gen 변화) 시 즉시 복귀
+ * @param tick_ms 틱 카운터 (ISR 이 증가)
+ * @param pending 대기 작업 확인 (NULL = 없음)
+ * @return 슬립한 횟수 (0 = 이미 만기이거나 대기 작업 있음)
+ * @note  틱마다 깨어나지만 슬롯을 다시 훑지 않고 마감 시각만 비교한다
+ */
+uint16_t sc_idle_wait(sc_idle_t* id, sc_sched_t* s, const volatile uint32_t* tick_ms,
+                      sc_idle_pending_fn_t pending);
+
+/**
+ * @brief 계측 값 복사 (창 누적값은 그대로)
+ */
+void sc_idle_get(const sc_idle_t* id, sc_idle_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_IDLE_H
@@ -0,0 +1,41 @@
+/**
+ * @file sched_input.c
+ * @brief 입력 캡처 구현
+ */
+
+#include "sched_input.h"
+#include "sched_port.h"
+
+static sc_in_snap_t      s_buf[2];
+static volatile uint8_t  s_front;    // 읽기용 버퍼 인덱스
+static volatile uint16_t s_seq;      // 완료된 캡처 수 (0 = 없음)
+
+void sc_in_capture(uint32_t tick_ms) {
+  uint8_t back = (uint8_t)(s_front ^ 1u);
+  sc_in_snap_t* b = &s_buf[back];
+  sc_port_in_read(b->port);
+  b->tick_ms = tick_ms;
+  b->seq = (uint16_t)(s_seq + 1);
+  if (!b->seq) b->seq = 1;           // 0 = 캡처 전 표시용
+  sc_port_barrier();                 // 버퍼 채움 → 게시 순서 고정
+  s_front = back;
+  s_seq = b->seq;
+}
+
+bool sc_in_get(sc_in_snap_t* out) {
+  uint16_t seq;
+  do {
+    seq = s_seq;
+    if (!seq) return false;
+    sc_port_barrier();               // 복사를 s_seq 읽기 사이에 가둠 (s_buf 는 volatile 아님)
+    *out = s_buf[s_front];
+    sc_port_barrier();
+  } while (seq != s_seq || out->seq != seq);   // 복사 중 캡처가 끼었으면 다시
+  return true;
+}
+
+uint8_t sc_in_read_pin(uint8_t pin) {
+  sc_in_snap_t s;
+  if (!sc_in_get(&s)) return 1;
+  return sc_in_pin(&s, pin);
+}
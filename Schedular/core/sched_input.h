@@ -0,0 +1,68 @@
+/**
+ * @file sched_input.h
+ * @brief 입력 캡처 — 틱 ISR 에서 디지털 포트 전체를 한 번에 래치하는 타임스탬프 스냅샷
+ * @details 드라이버/태스크가 각자 digitalRead() 하면 모듈마다 샘플 시점이 달라진다.
+ *          틱 ISR 이 sc_in_capture() 로 포트 레지스터를 한 번씩만 읽어 이중 버퍼에 쓰고,
+ *          모든 소비자는 sc_in_get()/sc_in_read_pin() 으로 같은 스냅샷을 읽는다.
+ *          - ISR 은 비활성 버퍼에 쓰고 인덱스만 뒤집는다 → 잠금 없음
+ *          - 읽는 쪽은 seq 를 전후로 비교해 복사 중 캡처가 끼면 다시 읽는다
+ *          - 틱 ISR 안에서 실행되는 태스크(sch.c 정적 테이블)는 같은 틱 스냅샷을 그대로 본다
+ *
+ *          포트/핀 배치는 ATmega328P (Uno) 기준: D0-7 = PIND, D8-13 = PINB, A0-A5(14-19) = PINC.
+ *          호스트는 sc_port_sim_input_source() 로 가상 포트 값을 공급한다.
+ */
+#ifndef SCHED_INPUT_H
+#define SCHED_INPUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SC_IN_PORTS 3    ///< 래치하는 포트 수 ([0]=D, [1]=B, [2]=C)
+
+/* Arduino 핀 번호 → 포트 인덱스 / 비트 */
+#define SC_IN_PORT_OF(pin) ((pin) < 8 ? 0 : (pin) < 14 ? 1 : 2)
+#define SC_IN_BIT_OF(pin)  ((pin) < 8 ? (pin) : (pin) < 14 ? (pin) - 8 : (pin) - 14)
+
+/**
+ * @brief 입력 스냅샷
+ */
+typedef struct {
+  uint32_t tick_ms;            ///< 캡처 시각
+  uint16_t seq;                ///< 캡처 순번 (래핑)
+  uint8_t  port[SC_IN_PORTS];  ///< 포트 입력 레지스터 값
+} sc_in_snap_t;
+
+/**
+ * @brief 캡처 (틱 ISR 에서 1회)
+ * @param tick_ms 이번 틱 시각
+ */
+void sc_in_capture(uint32_t tick_ms);
+
+/**
+ * @brief 최신 스냅샷 복사 (잠금 없음, ISR/메인 어디서나)
+ * @return false: 아직 캡처 전
+ */
+bool sc_in_get(sc_in_snap_t* out);
+
+/**
+ * @brief 스냅샷의 핀 레벨
+ */
+static inline uint8_t sc_in_pin(const sc_in_snap_t* s, uint8_t pin) {
+  return (uint8_t)((s->port[SC_IN_PORT_OF(pin)] >> SC_IN_BIT_OF(pin)) & 1u);
+}
+
+/**
+ * @brief 최신 스냅샷에서 핀 1개 읽기 (digitalRead 대체)
+ * @return 0/1 — 캡처 전이면 1 (풀업 유휴 레벨)
+ */
+uint8_t sc_in_read_pin(uint8_t pin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_INPUT_H
@@ -0,0 +1,77 @@
+/**
+ * @file sched_load.c
+ * @brief 과부하 감지 + 중요도 기반 부하 차단 구현
+ */
+
+#include "sched_load.h"
+#include "sched_port.h"
+
+int sc_load_init(sc_load_t* l, uint16_t late_ms, uint8_t enter_n, uint8_t exit_n) {
+  if (!l || late_ms == 0 || enter_n == 0 || exit_n == 0) return -2;
+
+  l->late_ms = late_ms;
+  l->enter_n = enter_n;
+  l->exit_n = exit_n;
+  l->level = SC_LOAD_OK;
+  l->level_max = SC_LOAD_OK;
+  l->run_bad = 0;
+  l->run_ok = 0;
+  l->late_max = 0;
+  l->overruns = 0;
+  l->enters = 0;
+  l->recovers = 0;
+  l->missed = 0;
+  l->shed = 0;
+  return 0;
+}
+
+/* 보고/차단은 태스크를 실행하는 한 문맥(메인 루프 또는 틱 ISR)에서만 — 잠금은 조회 쪽만 */
+void sc_load_report(sc_load_t* l, uint32_t late_ms) {
+  if (late_ms > l->late_max) l->late_max = (late_ms > 0xFFFFu) ? 0xFFFFu : (uint16_t)late_ms;
+
+  if (late_ms >= l->late_ms) {
+    l->overruns++;
+    l->run_ok = 0;
+    if (++l->run_bad < l->enter_n) return;
+    l->run_bad = 0;
+    if (l->level >= SC_LOAD_SHED) return;
+    if (l->level++ == SC_LOAD_OK) l->enters++;
+    if (l->level > l->level_max) l->level_max = l->level;
+  } else {
+    l->run_bad = 0;
+    if (l->level == SC_LOAD_OK || ++l->run_ok < l->exit_n) return;
+    l->run_ok = 0;
+    if (--l->level == SC_LOAD_OK) l->recovers++;
+  }
+}
+
+bool sc_load_admit(sc_load_t* l, uint8_t crit, uint8_t* cnt) {
+  if (l->level <= crit) {          // 단계 - 중요도 ≤ 0 → 정상 실행
+    *cnt = 0;
+    return true;
+  }
+  if (l->level - crit == 1 && ++*cnt >= SC_LOAD_DECIM) {
+    *cnt = 0;                      // 솎음: N 번째 릴리즈만 실행
+    return true;
+  }
+  l->shed++;
+  return false;
+}
+
+uint8_t sc_load_level(const sc_load_t* l) {
+  return l->level;
+}
+
+void sc_load_get_stats(const sc_load_t* l, sc_load_stats_t* out) {
+  if (!out) return;
+  uint8_t st = sc_port_lock();
+  out->level = l->level;
+  out->level_max = l->level_max;
+  out->late_max = l->late_max;
+  out->overruns = l->overruns;
+  out->enters = l->enters;
+  out->recovers = l->recovers;
+  out->missed = l->missed;
+  out->shed = l->shed;
+  sc_port_unlock(st);
+}
@@ -0,0 +1,111 @@
+/**
+ * @file sched_load.h
+ * @brief 과부하 감지 + 중요도 기반 부하 차단 (load shedding)
+ * @details 루프가 밀리면 주기 태스크는 늦게 실행되고, 한 주기 이상 밀린 릴리즈는 advance() 가
+ *          건너뛰어 조용히 사라진다. 감지기는 패스(틱)마다 관측한 지연으로 과부하 단계를 정하고,
+ *          코어는 단계와 태스크 중요도에 따라 낮은 중요도 주기 태스크를 솎거나 건너뛴다.
+ *          - 관측: 지연 ≥ late_ms 가 enter_n 회 연속 → 한 단계 올림, 미만이 exit_n 회 연속 → 한 단계 내림
+ *          - 단계 - 중요도 = 1 이면 SC_LOAD_DECIM 릴리즈 중 1회만 실행, 2 이상이면 건너뜀
+ *            (OVER: LOW 솎음 / SHED: LOW 건너뜀 + NORMAL 솎음 / HIGH 는 항상 실행)
+ *          - 차단은 주기 슬롯만 — 1회성/코루틴은 시퀀스라 항상 실행
+ *          - 건너뛴 릴리즈도 위상은 유지 (다음 릴리즈는 원래 격자)
+ *
+ *          코어 연동: sc_set_load() 로 인스턴스에 붙이면 sc_run() 이 패스마다 주기 태스크의
+ *          최대 지연을 보고하고, 놓친 릴리즈/차단 수를 센다. 코어 밖 디스패처(틱 ISR 의 정적 테이블,
+ *          사이클릭 프레임)는 sc_load_report()/sc_load_admit() 를 직접 부른다.
+ */
+#ifndef SCHED_LOAD_H
+#define SCHED_LOAD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===== 태스크 중요도 ===== */
+#define SC_CRIT_LOW     0   ///< 로그/텔레메트리 — 과부하 시 먼저 솎음
+#define SC_CRIT_NORMAL  1   ///< 기본 — 지속 과부하(SHED)에서만 솎음
+#define SC_CRIT_HIGH    2   ///< 고장 감지/안전 — 차단 안 함
+
+/* ===== 과부하 단계 ===== */
+#define SC_LOAD_OK      0   ///< 정상
+#define SC_LOAD_OVER    1   ///< 과부하
+#define SC_LOAD_SHED    2   ///< OVER 에서도 지연이 계속됨
+
+#ifndef SC_LOAD_DECIM
+#define SC_LOAD_DECIM   4   ///< 솎음 비율 — 릴리즈 N 회 중 1회 실행
+#endif
+
+/**
+ * @brief 감지기 인스턴스 (설정 + 상태 + 계측)
+ */
+typedef struct {
+  uint16_t late_ms;     ///< 과부하 관측 기준 지연 (ms, 1 이상)
+  uint8_t  enter_n;     ///< 연속 과부하 관측 → 단계 올림
+  uint8_t  exit_n;      ///< 연속 정상 관측 → 단계 내림
+  uint8_t  level;       ///< SC_LOAD_xxx
+  uint8_t  level_max;
+  uint8_t  run_bad;     ///< 연속 과부하 관측 수
+  uint8_t  run_ok;      ///< 연속 정상 관측 수
+  uint16_t late_max;    ///< 최대 관측 지연 (ms, 포화)
+  uint16_t overruns;    ///< 과부하 관측 수
+  uint16_t enters;      ///< OK → OVER 진입 수
+  uint16_t recovers;    ///< OVER → OK 복귀 수
+  uint32_t missed;      ///< 한 주기 이상 밀려 합쳐진 릴리즈 수
+  uint32_t shed;        ///< 차단으로 건너뛴 릴리즈 수
+} sc_load_t;
+
+/**
+ * @brief 계측 스냅샷
+ */
+typedef struct {
+  uint8_t  level;
+  uint8_t  level_max;
+  uint16_t late_max;
+  uint16_t overruns;
+  uint16_t enters;
+  uint16_t recovers;
+  uint32_t missed;
+  uint32_t shed;
+} sc_load_stats_t;
+
+/**
+ * @brief 감지기 초기화 (단계 OK, 계측 0)
+ * @param late_ms 이 지연 이상이면 과부하 관측 (예: 10ms 태스크면 주기의 절반)
+ * @param enter_n 단계를 올리는 연속 과부하 관측 수
+ * @param exit_n  단계를 내리는 연속 정상 관측 수 (복귀 히스테리시스)
+ * @return 0: 성공, -2: 잘못된 파라미터 (0 값)
+ */
+int sc_load_init(sc_load_t* l, uint16_t late_ms, uint8_t enter_n, uint8_t exit_n);
+
+/**
+ * @brief 관측 1회 보고 (패스/틱마다 1회)
+ * @param late_ms 이번 패스의 최대 지연 — 틱 ISR 이면 틱 주기 초과분
+ */
+void sc_load_report(sc_load_t* l, uint32_t late_ms);
+
+/**
+ * @brief 릴리즈 실행 여부 (차단이면 shed 집계)
+ * @param crit SC_CRIT_xxx
+ * @param cnt  태스크별 솎음 카운터 (1바이트, 0 초기화)
+ * @return true: 실행, false: 이번 릴리즈 건너뜀
+ */
+bool sc_load_admit(sc_load_t* l, uint8_t crit, uint8_t* cnt);
+
+/**
+ * @brief 현재 단계 (SC_LOAD_xxx)
+ */
+uint8_t sc_load_level(const sc_load_t* l);
+
+/**
+ * @brief 계측 값 조회
+ */
+void sc_load_get_stats(const sc_load_t* l, sc_load_stats_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_LOAD_H
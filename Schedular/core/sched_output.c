@@ -0,0 +1,61 @@
+/**
+ * @file sched_output.c
+ * @brief 출력 섀도 레지스터 구현
+ */
+
+#include "sched_output.h"
+#include "sched_port.h"
+
+/* 비교 ISR 이 sc_out_note() 로 함께 고치므로 read-modify-write 는 잠금 안에서 */
+static uint8_t s_shadow[SC_OUT_PORTS];   // 예약된 출력 레벨
+static uint8_t s_dirty[SC_OUT_PORTS];    // 다음 커밋에서 쓸 비트
+
+void sc_out_init(void) {
+  sc_port_out_read(s_shadow);
+  for (uint8_t i = 0; i < SC_OUT_PORTS; ++i) s_dirty[i] = 0;
+}
+
+void sc_out_write(uint8_t pin, uint8_t level) {
+  uint8_t p = SC_IN_PORT_OF(pin);
+  uint8_t m = (uint8_t)(1u << SC_IN_BIT_OF(pin));
+  uint8_t st = sc_port_lock();
+  if (level) s_shadow[p] |= m;
+  else       s_shadow[p] &= (uint8_t)~m;
+  s_dirty[p] |= m;
+  sc_port_unlock(st);
+}
+
+void sc_out_toggle(uint8_t pin) {
+  uint8_t p = SC_IN_PORT_OF(pin);
+  uint8_t m = (uint8_t)(1u << SC_IN_BIT_OF(pin));
+  uint8_t st = sc_port_lock();
+  s_shadow[p] ^= m;
+  s_dirty[p] |= m;
+  sc_port_unlock(st);
+}
+
+void sc_out_note(uint8_t pin, uint8_t level) {
+  uint8_t p = SC_IN_PORT_OF(pin);
+  uint8_t m = (uint8_t)(1u << SC_IN_BIT_OF(pin));
+  uint8_t st = sc_port_lock();
+  if (level) s_shadow[p] |= m;
+  else       s_shadow[p] &= (uint8_t)~m;
+  s_dirty[p] &= (uint8_t)~m;
+  sc_port_unlock(st);
+}
+
+uint8_t sc_out_level(uint8_t pin) {
+  return (uint8_t)((s_shadow[SC_IN_PORT_OF(pin)] >> SC_IN_BIT_OF(pin)) & 1u);
+}
+
+uint8_t sc_out_commit(void) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < SC_OUT_PORTS; ++i) if (s_dirty[i]) n++;
+  if (!n) return 0;
+
+  uint8_t st = sc_port_lock();   // 쓰기 ~ dirty 정리 사이에 sc_out_note() 가 끼지 않게
+  sc_port_out_write(s_dirty, s_shadow);
+  for (uint8_t i = 0; i < SC_OUT_PORTS; ++i) s_dirty[i] = 0;
+  sc_port_unlock(st);
+  return n;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file sched_output.h
+ * @brief 출력 섀도 레지스터 — 태스크는 비트만 바꾸고 포트 쓰기는 틱 끝에 한 번
+ * @details digitalWrite() 는 호출마다 핀 → 포트 테이블 조회 + 인터럽트 금지 read-modify-write 이고,
+ *          토글은 digitalRead() 까지 더한다. 같은 틱에 여러 태스크가 핀을 바꾸면 엣지도 제각각이다.
+ *          - sc_out_write()/sc_out_toggle() 은 RAM 섀도의 비트와 dirty 마스크만 바꾼다
+ *          - 스케줄러가 그 틱의 태스크를 모두 실행한 뒤 sc_out_commit() 으로 dirty 포트를
+ *            포트당 1회 쓴다 → 같은 포트의 엣지는 동시, 포트 간은 잠금 구간 안 연속 쓰기
+ *          - 쓰는 것은 dirty 비트뿐 → 시리얼 등 다른 주인의 핀은 건드리지 않음
+ *
+ *          sc_out_write/toggle/commit 은 같은 문맥(태스크를 실행하는 메인 루프 또는 틱 ISR)에서만 호출한다.
+ *          ISR 에서 핀을 즉시 바꿔야 하면 sc_port_pin_write() 후 sc_out_note() 로 섀도를 맞춘다
+ *          (sched_hrt 의 핀 동작은 자동) — 그래야 sc_out_level()/sc_out_toggle() 이 실제 레벨 기준.
+ *          포트 쓰기는 타이머 PWM 출력을 끄지 않으므로 analogWrite() 핀에는 쓰지 않는다
+ *          (setup() 의 첫 digitalWrite() 가 PWM 을 끈 뒤에는 사용 가능).
+ *
+ *          포트/핀 배치는 sched_input.h 와 같다 (ATmega328P: D0-7 = PORTD, D8-13 = PORTB, A0-A5 = PORTC).
+ */
+#ifndef SCHED_OUTPUT_H
+#define SCHED_OUTPUT_H
+
+#include <stdint.h>
+#include "sched_input.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SC_OUT_PORTS SC_IN_PORTS   ///< 섀도 포트 수 ([0]=D, [1]=B, [2]=C)
+
+/**
+ * @brief 섀도를 현재 출력 래치 값으로 맞춤 (pinMode/초기 digitalWrite 이후 1회)
+ * @note  sc_out_write() 만 쓰면 생략 가능 — 커밋은 dirty 비트만 쓴다. 섀도 기준인
+ *        sc_out_toggle()/sc_out_level() 을 쓰기 전에는 필요
+ */
+void sc_out_init(void);
+
+/**
+ * @brief 핀 레벨 예약 (digitalWrite 대체, 다음 sc_out_commit() 에서 반영)
+ * @param level 0/1
+ * @note  같은 레벨이어도 dirty 로 표시 → 비교 ISR 이 바꿔 놓은 핀도 다시 맞춘다
+ */
+void sc_out_write(uint8_t pin, uint8_t level);
+
+/**
+ * @brief 핀 토글 예약 (섀도 기준 — digitalRead 없음)
+ */
+void sc_out_toggle(uint8_t pin);
+
+/**
+ * @brief 섀도의 핀 레벨 (예약 포함, 출력 핀 digitalRead 대체)
+ */
+uint8_t sc_out_level(uint8_t pin);
+
+/**
+ * @brief 이미 직접 쓴 핀의 레벨을 섀도에 반영 (ISR-safe)
+ * @param level 0/1
+ * @note  그 핀의 미커밋 예약은 취소 — 직접 쓰기가 더 나중이므로 커밋이 되돌리지 않게 한다
+ */
+void sc_out_note(uint8_t pin, uint8_t level);
+
+/**
+ * @brief dirty 포트 일괄 쓰기 (틱의 태스크 실행 후 1회)
+ * @return 쓴 포트 수 (0 = 바뀐 핀 없음)
+ */
+uint8_t sc_out_commit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_OUTPUT_H
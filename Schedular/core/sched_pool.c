@@ -0,0 +1,64 @@
+/**
+ * @file sched_pool.c
+ * @brief 고정 블록 메모리 풀 구현
+ */
+
+#include "sched_pool.h"
+#include "sched_port.h"
+
+int sc_pool_init(sc_pool_t* p, void* storage, uint16_t block, uint8_t count) {
+  if (!p || !storage || block == 0 || count == 0 || count >= SC_POOL_END) return -2;
+
+  p->mem = (uint8_t*)storage;
+  p->stride = (uint16_t)SC_POOL_STRIDE(block);
+  p->block = block;
+  p->count = count;
+  for (uint8_t i = 0; i < count; ++i) {
+    p->mem[(uint16_t)i * p->stride] = (uint8_t)((i + 1 < count) ? i + 1 : SC_POOL_END);
+  }
+  p->free_head = 0;
+  p->used = 0;
+  p->hwm = 0;
+  p->fail = 0;
+  return 0;
+}
+
+void* sc_pool_alloc(sc_pool_t* p) {
+  uint8_t st = sc_port_lock();
+  uint8_t i = p->free_head;
+  if (i == SC_POOL_END) {
+    p->fail++;
+    sc_port_unlock(st);
+    return NULL;
+  }
+  uint8_t* blk = &p->mem[(uint16_t)i * p->stride];
+  p->free_head = blk[0];
+  if (++p->used > p->hwm) p->hwm = p->used;
+  sc_port_unlock(st);
+  return blk;
+}
+
+void sc_pool_free(sc_pool_t* p, void* blk) {
+  if (!p || !blk) return;
+  uint8_t* b = (uint8_t*)blk;
+  if (b < p->mem) return;
+  uint16_t off = (uint16_t)(b - p->mem);
+  if (off % p->stride || off / p->stride >= p->count) return;
+
+  uint8_t st = sc_port_lock();
+  b[0] = p->free_head;
+  p->free_head = (uint8_t)(off / p->stride);
+  p->used--;
+  sc_port_unlock(st);
+}
+
+void sc_pool_get_stats(const sc_pool_t* p, sc_pool_stats_t* out) {
+  if (!out) return;
+  uint8_t st = sc_port_lock();
+  out->used = p->used;
+  out->hwm = p->hwm;
+  out->count = p->count;
+  out->block = p->block;
+  out->fail = p->fail;
+  sc_port_unlock(st);
+}
@@ -0,0 +1,97 @@
+/**
+ * @file sched_pool.h
+ * @brief 고정 블록 메모리 풀 — 인자 있는 태스크/워크의 컨텍스트 저장소
+ * @details 태스크 인자가 void* 하나뿐이면 호출자가 컨텍스트를 정적 전역으로 잡아 두어야 하고,
+ *          가끔만 쓰는 워크도 RAM 을 상시 차지한다. 풀은 같은 크기 블록 N 개를 공유한다.
+ *          - 빈 블록은 블록 첫 바이트에 다음 빈 블록 번호를 적은 단일 연결 리스트 → 할당/반환 O(1)
+ *          - 할당/반환은 sc_port_lock() 구간 안 → ISR 에서도 호출 가능
+ *          - 저장소는 호출자 배열 (SC_POOL_STORAGE) → 힙 없음
+ *
+ *          코어 연동: sc_set_pool() 로 인스턴스에 풀을 붙이면 sc_add_ctx_at() 이 블록을 받아
+ *          컨텍스트를 복사하고, 1회성 완료/취소 시 슬롯 반환과 함께 블록도 자동 반환한다.
+ */
+#ifndef SCHED_POOL_H
+#define SCHED_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 블록 정렬 단위 — 컨텍스트 구조체의 어떤 멤버도 블록 시작에서 정렬되도록 */
+typedef union {
+  void*    p;
+  uint32_t u32;
+  uint64_t u64;
+  double   d;
+} sc_pool_align_t;
+
+#define SC_POOL_STRIDE(block) \
+  ((((block) + sizeof(sc_pool_align_t) - 1) / sizeof(sc_pool_align_t)) * sizeof(sc_pool_align_t))
+
+/**
+ * @brief 풀 저장소 선언 — static SC_POOL_STORAGE(s_ctx_mem, 16, 8);
+ */
+#define SC_POOL_STORAGE(name, block, count) \
+  sc_pool_align_t name[(SC_POOL_STRIDE(block) / sizeof(sc_pool_align_t)) * (count)]
+
+#define SC_POOL_END 0xFF   ///< 빈 목록 끝
+
+/**
+ * @brief 풀 인스턴스
+ */
+typedef struct {
+  uint8_t* mem;
+  uint16_t stride;      ///< 블록 간격 (정렬 단위로 올림)
+  uint16_t block;       ///< 사용 가능 크기 (bytes)
+  uint8_t  count;       ///< 블록 수 (최대 255)
+  uint8_t  free_head;   ///< 첫 빈 블록 (SC_POOL_END = 없음)
+  uint8_t  used;        ///< 사용 중 블록 수
+  uint8_t  hwm;         ///< 최대 동시 사용 수
+  uint16_t fail;        ///< 빈 블록이 없어 실패한 횟수
+} sc_pool_t;
+
+/**
+ * @brief 계측 스냅샷
+ */
+typedef struct {
+  uint8_t  used;
+  uint8_t  hwm;
+  uint8_t  count;
+  uint16_t block;
+  uint16_t fail;
+} sc_pool_stats_t;
+
+/**
+ * @brief 풀 초기화 (모든 블록 빈 상태)
+ * @param storage SC_POOL_STORAGE(name, block, count) 로 선언한 배열
+ * @param block   블록 크기 (bytes, 1 이상)
+ * @param count   블록 수 (1 ~ 254)
+ * @return 0: 성공, -2: 잘못된 파라미터
+ */
+int sc_pool_init(sc_pool_t* p, void* storage, uint16_t block, uint8_t count);
+
+/**
+ * @brief 블록 할당 (O(1), ISR 에서 호출 가능)
+ * @return 블록 주소, 빈 블록이 없으면 NULL
+ */
+void* sc_pool_alloc(sc_pool_t* p);
+
+/**
+ * @brief 블록 반환 (O(1), ISR 에서 호출 가능)
+ * @note  NULL / 풀 밖 주소는 무시
+ */
+void sc_pool_free(sc_pool_t* p, void* blk);
+
+/**
+ * @brief 계측 값 조회
+ */
+void sc_pool_get_stats(const sc_pool_t* p, sc_pool_stats_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_POOL_H
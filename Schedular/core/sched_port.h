@@ -0,0 +1,185 @@
+/**
+ * @file sched_port.h
+ * @brief 스케줄러 포트 계층 (틱 소스 + 인터럽트 잠금 + 시간축 + 비교 타이머)
+ * @details 타깃마다 구현 파일 1개:
+ *          - sched_port_avr.c    : Timer2 CTC 1ms + 소프트웨어 분주, SREG 저장/복원
+ *          - sched_port_rp2040.c : pico SDK 반복 타이머 + 64비트 하드웨어 타이머, PRIMASK 저장/복원
+ *          - sched_port_host.c   : 주기 기록, 틱은 시뮬레이션 루프 또는 sc_port_sleep() 이 발생
+ *          모든 파일이 SC_PORT_xxx 로 자기 타깃에서만 컴파일되므로 함께 복사해도 된다.
+ */
+#ifndef SCHED_PORT_H
+#define SCHED_PORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ===== 타깃 선택 (구현 파일이 하나만 컴파일되도록) ===== */
+#if defined(__AVR__)
+#define SC_PORT_AVR    1
+#elif defined(PICO_RP2040) || defined(ARDUINO_ARCH_RP2040)
+#define SC_PORT_RP2040 1
+#else
+#define SC_PORT_HOST   1
+#endif
+
+/**
+ * @brief 틱 콜백 (ISR 컨텍스트)
+ */
+typedef void (*sc_port_tick_fn_t)(void);
+
+/**
+ * @brief 틱 소스 시작
+ * @param period_ms 콜백 호출 주기 (1 ~ 255 ms)
+ * @param on_tick   period_ms 마다 ISR 에서 호출할 함수
+ * @note  sc_port_time_us() 원점도 이 시점(0)으로 맞춘다 → 0 에서 시작하는 틱 카운터와 같은 원점
+ */
+void sc_port_tick_start(uint8_t period_ms, sc_port_tick_fn_t on_tick);
+
+/**
+ * @brief 틱 주기 변경 (다음 틱부터 적용)
+ */
+void sc_port_tick_set_period(uint8_t period_ms);
+
+/**
+ * @brief 현재 틱 주기 (ms)
+ */
+uint8_t sc_port_tick_period(void);
+
+/**
+ * @brief 인터럽트 잠금 (중첩 가능 — 이전 상태를 돌려줌)
+ */
+uint8_t sc_port_lock(void);
+
+/**
+ * @brief 잠금 해제 (sc_port_lock() 반환값 복원)
+ */
+void sc_port_unlock(uint8_t state);
+
+/**
+ * @brief 컴파일러 메모리 배리어 — 일반 변수 접근을 이 지점 너머로 옮기지 못하게 함
+ * @note  단일 코어 ISR ↔ 메인 공유(seqlock 등)용. CPU 배리어는 아님
+ */
+#if defined(__GNUC__)
+#define sc_port_barrier() __asm__ __volatile__("" ::: "memory")
+#else
+#define sc_port_barrier() do { uint8_t st_ = sc_port_lock(); sc_port_unlock(st_); } while (0)
+#endif
+
+/* ===== 슬립 단계 (sched_idle 이 결정, 포트가 하드웨어 모드로 매핑) ===== */
+#define SC_SLEEP_LIGHT 1  ///< 다음 틱 안에 마감 — CPU 클럭만 정지
+#define SC_SLEEP_DEEP  2  ///< 마감이 SC_IDLE_DEEP_MS 이상 남음 — 포트가 허용하는 가장 깊은 모드
+
+/**
+ * @brief 다음 인터럽트까지 슬립
+ * @param state sc_port_lock() 반환값 — 잠근 상태로 호출해야 검사~슬립 사이에 깨우는 인터럽트를 놓치지 않음
+ * @param level SC_SLEEP_xxx
+ * @note  인터럽트를 허용하며 잠들고, 깨어난 뒤 state 를 복원해 돌아온다
+ */
+void sc_port_sleep(uint8_t state, uint8_t level);
+
+/**
+ * @brief 자유 구동 us 카운터 (래핑, 이용률/여유 계측용)
+ */
+uint32_t sc_port_us(void);
+
+/**
+ * @brief 64비트 단조 us 시각 (sc_port_tick_start() 기준, sched_time.h 의 sc_time_us())
+ * @note  하드웨어 카운터 + 소프트웨어 오버플로 확장. 인터럽트를 막지 않고 읽으며
+ *        ISR/잠금 구간에서도 호출 가능 (미처리 비교 일치는 플래그로 보정)
+ */
+uint64_t sc_port_time_us(void);
+
+/* ===== 고해상도 비교 타이머 (sched_hrt 가 사용) ===== */
+
+/**
+ * @brief 비교 일치 콜백 등록 (ISR 컨텍스트에서 호출됨)
+ */
+void sc_port_hrt_init(sc_port_tick_fn_t on_match);
+
+/**
+ * @brief 비교 타이머를 due_us (sc_port_time_us() 기준) 에 1회 맞춤 — 이전 설정은 대체
+ * @return true: 설정됨, false: 이미 지난 시각 (호출자가 바로 처리)
+ * @note  잠금 상태에서 호출. 틱 주기를 올리지 않고 틱 사이 시각에 인터럽트를 발생시킨다
+ *        (AVR: Timer2 OCR2B, 4us 해상도 / RP2040: 하드웨어 알람 / 호스트: 시뮬레이션)
+ */
+bool sc_port_hrt_arm(uint64_t due_us);
+
+/**
+ * @brief 비교 타이머 해제
+ */
+void sc_port_hrt_disarm(void);
+
+/**
+ * @brief 출력 핀 직접 쓰기 (비교 ISR 의 핀 동작용, digitalWrite 보다 짧은 경로)
+ * @param pin   Arduino 핀 번호 (sched_input.h 와 같은 포트 배치)
+ * @param level 0/1
+ */
+void sc_port_pin_write(uint8_t pin, uint8_t level);
+
+/**
+ * @brief 디지털 입력 포트 일괄 읽기 (sched_input 캡처용, ISR 컨텍스트)
+ * @param port SC_IN_PORTS 바이트 — 포트당 레지스터 1회 읽기
+ */
+void sc_port_in_read(uint8_t* port);
+
+/**
+ * @brief 출력 포트 일괄 쓰기 (sched_output 커밋용)
+ * @param mask SC_IN_PORTS 바이트 — 포트별로 쓸 비트 (0 이면 그 포트는 건드리지 않음)
+ * @param val  SC_IN_PORTS 바이트 — mask 비트의 레벨
+ * @note  한 번의 잠금 구간에서 포트당 1회 read-modify-write (RP2040 은 SIO 마스크 쓰기 1회)
+ */
+void sc_port_out_write(const uint8_t* mask, const uint8_t* val);
+
+/**
+ * @brief 출력 래치 일괄 읽기 (sched_output 섀도 초기화용)
+ * @param port SC_IN_PORTS 바이트
+ */
+void sc_port_out_read(uint8_t* port);
+
+#if SC_PORT_HOST
+/**
+ * @brief 호스트 시뮬레이션: 틱 1회 발생 (등록된 콜백 호출)
+ */
+void sc_port_sim_tick(void);
+
+/**
+ * @brief 호스트 시뮬레이션: 실시간 모드
+ * @param on true: sc_port_sleep() 이 clock_nanosleep 으로 다음 틱 경계까지 스레드를 재운 뒤 틱 발생,
+ *              sc_port_time_us() 는 CLOCK_MONOTONIC
+ *           false(기본): 대기 없이 즉시 틱 발생 (가상 시간 — 회귀 비교용),
+ *              sc_port_time_us() 는 틱마다 주기만큼 전진하는 가상 시각
+ */
+void sc_port_sim_realtime(bool on);
+
+/**
+ * @brief 호스트 시뮬레이션: 빈 시간 건너뛰기 (가상 시간 모드 전용, 실시간 모드는 무시)
+ * @param ms 틱 없이 진행시킬 시간 — 다음 sc_port_sleep() 의 틱은 ms + 주기 뒤 경계에서 발생
+ * @note  호출자(틱 콜백)가 그 틱에서 ms 만큼 더 진행해야 틱 카운터와 sc_port_time_us() 가 맞는다.
+ *        건너뛴 구간 안의 비교 일치는 여기서 제시각 순서대로 먼저 발생시킨다.
+ */
+void sc_port_sim_fast_forward(uint32_t ms);
+
+/**
+ * @brief 호스트 시뮬레이션: 입력 포트 값 공급 함수 (NULL = 모두 1, 풀업 유휴)
+ */
+typedef void (*sc_port_sim_in_fn_t)(uint8_t* port);
+void sc_port_sim_input_source(sc_port_sim_in_fn_t fn);
+
+/**
+ * @brief 호스트 시뮬레이션: 핀 출력 관찰 함수 (sc_port_pin_write() 마다, sc_port_out_write() 는 쓴 비트마다 호출, NULL = 무시)
+ * @note  가상 시간 모드의 비교 일치는 다음 틱 전에 시각을 마감 시각으로 옮겨 발생시킨다
+ *        → 콜백 안의 sc_port_time_us() 가 곧 엣지 시각
+ */
+typedef void (*sc_port_sim_pin_fn_t)(uint8_t pin, uint8_t level);
+void sc_port_sim_pin_sink(sc_port_sim_pin_fn_t fn);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_PORT_H
@@ -0,0 +1,213 @@
+/**
+ * @file sched_port_avr.c
+ * @brief 스케줄러 포트 — AVR (ATmega328P, 16MHz)
+ * @details Timer2 CTC 1ms 하드웨어 틱에 소프트웨어 분주를 붙여 period_ms 마다 콜백한다.
+ *          16MHz / 64 = 250kHz → 1ms 당 250 카운트 → OCR2A = 249
+ *          슬립: Timer2 가 시스템 클럭(동기)으로 돌기 때문에 power-save 이하에서는 틱이 멈춘다.
+ *          따라서 SC_SLEEP_LIGHT/DEEP 모두 SLEEP_MODE_IDLE 로 매핑한다 (32kHz 크리스털로
+ *          Timer2 를 비동기 구동하는 보드라면 DEEP 을 SLEEP_MODE_PWR_SAVE 로 바꿀 수 있다).
+ *          시간축: ISR 이 us 누적(하위 32비트 + 래핑 확장 32비트)을 갱신하고 순번을 올린다.
+ *          읽는 쪽은 cli 없이 순번 전후 비교로 재시도하고 TCNT2(4us 해상도)를 더한다.
+ *          비교 타이머: 같은 Timer2 의 OCR2B. 마감이 현재 1ms 창 안에 들어오면 OCR2B 에 창 내
+ *          카운트를 쓰고 COMPB 인터럽트를 켠다. 더 먼 마감은 매 1ms COMPA ISR 이 창이 바뀔 때
+ *          다시 시도한다 → 틱 주기를 올리지 않고 4us 해상도 엣지.
+ */
+#include "sched_port.h"
+
+#if SC_PORT_AVR
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "sched_input.h"
+
+static sc_port_tick_fn_t s_on_tick;
+static volatile uint8_t  s_period = 1;
+static uint8_t           s_div;      // 1ms 분주 카운터
+static volatile uint32_t s_us_lo;    // us 누적 하위 (1ms 하드웨어 틱마다 +1000)
+static volatile uint32_t s_us_hi;    // 하위 래핑 확장 (~71.6분마다 +1)
+static volatile uint8_t  s_seq;      // ISR 갱신 순번 — 잠금 없는 읽기의 재시도 판정
+
+static sc_port_tick_fn_t s_on_match;  // 비교 일치 콜백 (sched_hrt)
+static uint64_t          s_cmp_due;   // 비교 마감 (us)
+static volatile uint8_t  s_cmp_armed;
+
+void sc_port_tick_start(uint8_t period_ms, sc_port_tick_fn_t on_tick)
+{
+  cli();
+  s_on_tick = on_tick;
+  s_period = period_ms ? period_ms : 1;
+  s_div = 0;
+  s_us_lo = 0;
+  s_us_hi = 0;
+  TCCR2A = (1 << WGM21);           // CTC mode
+  TCCR2B = 0;
+  TCNT2  = 0;
+  OCR2A  = 249;                    // TOP
+  TIMSK2 = (1 << OCIE2A);          // Interrupt on compare match
+  TCCR2B = (1 << CS22);            // prescaler = 64
+  sei();
+}
+
+void sc_port_tick_set_period(uint8_t period_ms)
+{
+  uint8_t sreg = SREG;
+  cli();
+  s_period = period_ms ? period_ms : 1;
+  s_div = 0;
+  SREG = sreg;
+}
+
+uint8_t sc_port_tick_period(void)
+{
+  return s_period;
+}
+
+uint8_t sc_port_lock(void)
+{
+  uint8_t sreg = SREG;
+  cli();
+  return sreg;
+}
+
+void sc_port_unlock(uint8_t state)
+{
+  SREG = state;
+}
+
+void sc_port_sleep(uint8_t state, uint8_t level)
+{
+  (void)level;
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_enable();
+  sei();          // sei 직후 1명령(sleep)은 인터럽트보다 먼저 실행 → 검사~슬립 사이 경합 없음
+  sleep_cpu();
+  sleep_disable();
+  SREG = state;
+}
+
+uint64_t sc_port_time_us(void)
+{
+  uint8_t seq, cnt, pend;
+  uint32_t lo, hi;
+  do {
+    seq = s_seq;
+    lo = s_us_lo;
+    hi = s_us_hi;
+    cnt = TCNT2;
+    pend = TIFR2 & (1 << OCF2A);
+  } while (seq != s_seq);   // 읽는 도중 ISR 실행 → 다시 (ISR 은 중첩되지 않으므로 1회면 충분)
+
+  uint32_t add = (uint32_t)cnt * 4;               // 1 카운트 = 4us
+  if (pend && cnt < 249) add += 1000;             // 비교 일치 후 ISR 미처리분 (잠금/ISR 안에서 호출)
+  uint32_t us = lo + add;
+  if (us < lo) hi++;
+  return ((uint64_t)hi << 32) | us;
+}
+
+uint32_t sc_port_us(void)
+{
+  return (uint32_t)sc_port_time_us();
+}
+
+/*
+ * 마감이 현재 1ms 창(TCNT2 = 0 일 때 us 누적값부터 1000us) 안이면 OCR2B 설정
+ * 잠금/ISR 안에서 호출. COMPA 미처리(창 경계 직후)면 그 ISR 이 새 창 기준으로 다시 부른다.
+ */
+static void cmp_program(void)
+{
+  if (!s_cmp_armed || (TIFR2 & (1 << OCF2A))) return;
+  uint64_t base = ((uint64_t)s_us_hi << 32) | s_us_lo;
+  if (s_cmp_due >= base + 1000) return;            // 이후 창 — COMPA ISR 이 다시 시도
+
+  uint8_t ocr = (s_cmp_due > base) ? (uint8_t)((uint16_t)(s_cmp_due - base + 3) >> 2) : 0;  // 올림
+  for (uint8_t retry = 0; retry < 2; ++retry) {
+    uint8_t cnt = TCNT2;
+    if (ocr <= cnt) ocr = (uint8_t)(cnt + 1);      // 이미 지났거나 바로 지금 → 다음 카운트
+    if (ocr > 249) return;                         // 창 끝 — 다음 창 첫 COMPA 에서 처리
+    OCR2B = ocr;
+    TIFR2 = (1 << OCF2B);                          // 이전 일치 플래그 제거 (1 을 써서 클리어)
+    TIMSK2 |= (1 << OCIE2B);
+    if (TCNT2 < ocr || (TIFR2 & (1 << OCF2B))) return;  // 쓰는 사이 지나치지 않음
+  }
+}
+
+void sc_port_hrt_init(sc_port_tick_fn_t on_match)
+{
+  s_on_match = on_match;
+}
+
+bool sc_port_hrt_arm(uint64_t due_us)
+{
+  TIMSK2 &= (uint8_t)~(1 << OCIE2B);
+  if (due_us <= sc_port_time_us()) {
+    s_cmp_armed = 0;
+    return false;
+  }
+  s_cmp_due = due_us;
+  s_cmp_armed = 1;
+  cmp_program();
+  return true;
+}
+
+void sc_port_hrt_disarm(void)
+{
+  TIMSK2 &= (uint8_t)~(1 << OCIE2B);
+  s_cmp_armed = 0;
+}
+
+void sc_port_pin_write(uint8_t pin, uint8_t level)
+{
+  volatile uint8_t* reg = (SC_IN_PORT_OF(pin) == 0) ? &PORTD : (SC_IN_PORT_OF(pin) == 1) ? &PORTB : &PORTC;
+  uint8_t mask = (uint8_t)(1u << SC_IN_BIT_OF(pin));
+  uint8_t sreg = SREG;
+  cli();
+  if (level) *reg |= mask;
+  else       *reg &= (uint8_t)~mask;
+  SREG = sreg;
+}
+
+void sc_port_in_read(uint8_t* port)
+{
+  port[0] = PIND;   // D0-D7
+  port[1] = PINB;   // D8-D13
+  port[2] = PINC;   // A0-A5
+}
+
+void sc_port_out_write(const uint8_t* mask, const uint8_t* val)
+{
+  uint8_t sreg = SREG;
+  cli();
+  if (mask[0]) PORTD = (uint8_t)((PORTD & (uint8_t)~mask[0]) | (val[0] & mask[0]));
+  if (mask[1]) PORTB = (uint8_t)((PORTB & (uint8_t)~mask[1]) | (val[1] & mask[1]));
+  if (mask[2]) PORTC = (uint8_t)((PORTC & (uint8_t)~mask[2]) | (val[2] & mask[2]));
+  SREG = sreg;
+}
+
+void sc_port_out_read(uint8_t* port)
+{
+  port[0] = PORTD;
+  port[1] = PORTB;
+  port[2] = PORTC;
+}
+
+ISR(TIMER2_COMPA_vect)
+{
+  uint32_t lo = s_us_lo + 1000;
+  s_us_lo = lo;
+  if (lo < 1000) s_us_hi++;
+  s_seq++;
+  if (s_cmp_armed) cmp_program();   // 마감이 이번 창에 들어왔으면 OCR2B 설정
+  if (++s_div < s_period) return;
+  s_div = 0;
+  if (s_on_tick) s_on_tick();
+}
+
+ISR(TIMER2_COMPB_vect)
+{
+  TIMSK2 &= (uint8_t)~(1 << OCIE2B);
+  s_cmp_armed = 0;
+  if (s_on_match) s_on_match();
+}
+
+#endif /* SC_PORT_AVR */
@@ -0,0 +1,244 @@
+/**
+ * @file sched_port_host.c
+ * @brief 스케줄러 포트 — 호스트 시뮬레이션
+ * @details 하드웨어 타이머가 없으므로 주기만 기록한다. 시뮬레이션 루프가
+ *          sc_port_sim_tick() (또는 틱 핸들러 직접 호출) 1회를 주기만큼의 시간 경과로 간주한다.
+ *          sc_port_sleep() 은 "다음 인터럽트 = 다음 틱" 으로 보고 틱을 직접 발생시킨다.
+ *          실시간 모드에서는 그 전에 clock_nanosleep(TIMER_ABSTIME) 으로 틱 경계까지 스레드를
+ *          재우므로 시뮬레이터가 코어 하나를 점유하지 않는다 (절대 시각 기준 → 누적 지연 없음).
+ *          시간축: 실시간 모드는 CLOCK_MONOTONIC, 가상 모드는 틱마다 주기만큼 전진하는 카운터
+ *          (가상 모드에서 sc_port_time_us() / 1000 == 틱 카운터 → 출력이 실행 환경과 무관).
+ *          비교 타이머: 마감이 다음 틱 경계 전이면 sc_port_sleep() 이 틱 대신 비교 일치를 발생시킨다
+ *          (가상 모드는 시각을 마감으로 옮김, 실시간 모드는 마감까지 clock_nanosleep).
+ *          시간 압축: sc_port_sim_fast_forward() 는 가상 시간축만 옮겨 빈 틱을 건너뛴다 (소크 시뮬레이션).
+ *          출력: 가상 출력 래치(3포트) + 관찰 함수 — sc_port_out_write() 는 쓴 비트마다 핀 단위로 알린다.
+ *          단일 스레드이므로 잠금은 비어 있다.
+ */
+#define _POSIX_C_SOURCE 200112L
+#include "sched_port.h"
+
+#if SC_PORT_HOST
+
+#include <stddef.h>
+#include <errno.h>
+#include <time.h>
+#include "sched_input.h"
+
+static sc_port_tick_fn_t s_on_tick;
+static uint8_t           s_period = 1;
+static bool              s_realtime;
+static struct timespec   s_next;     // 다음 틱 경계 (CLOCK_MONOTONIC 절대 시각)
+static struct timespec   s_origin;   // 실시간 모드 시간축 원점
+static uint64_t          s_vtime_us; // 가상 모드 시간축
+static uint64_t          s_vtick_us; // 가상 모드 마지막 틱 경계
+static sc_port_sim_in_fn_t s_in_source;
+static sc_port_sim_pin_fn_t s_pin_sink;
+static uint8_t           s_out[3];   // 가상 출력 래치 (sched_input.h 포트 배치)
+static sc_port_tick_fn_t s_on_match;
+static uint64_t          s_cmp_due;
+static bool              s_cmp_armed;
+
+static uint64_t ts_us(const struct timespec* ts)
+{
+  return (uint64_t)ts->tv_sec * 1000000u + (uint64_t)ts->tv_nsec / 1000u;
+}
+
+static void ts_add_us(struct timespec* ts, uint64_t us)
+{
+  ts->tv_sec += (time_t)(us / 1000000u);
+  ts->tv_nsec += (long)(us % 1000000u) * 1000L;
+  while (ts->tv_nsec >= 1000000000L) {
+    ts->tv_nsec -= 1000000000L;
+    ts->tv_sec++;
+  }
+}
+
+/* 틱 1회 — 가상 시간축을 먼저 전진시켜 콜백 안에서 읽는 시각이 틱 카운터와 일치 */
+static void fire_tick(void)
+{
+  s_vtick_us += (uint64_t)s_period * 1000u;
+  s_vtime_us = s_vtick_us;
+  if (s_on_tick) s_on_tick();
+}
+
+/* 비교 일치 1회 (1회성 — 콜백이 다시 설정) */
+static void fire_match(void)
+{
+  s_cmp_armed = false;
+  if (s_on_match) s_on_match();
+}
+
+/* 가상 모드: 다음 틱 경계 전 마감이면 시각을 옮겨 발생 (경계와 같으면 틱 먼저 — AVR 벡터 우선순위와 동일) */
+static bool sim_match_before_tick(void)
+{
+  if (!s_cmp_armed || s_cmp_due >= s_vtick_us + (uint64_t)s_period * 1000u) return false;
+  if (s_cmp_due > s_vtime_us) s_vtime_us = s_cmp_due;
+  fire_match();
+  return true;
+}
+
+void sc_port_tick_start(uint8_t period_ms, sc_port_tick_fn_t on_tick)
+{
+  s_on_tick = on_tick;
+  s_period = period_ms ? period_ms : 1;
+  s_vtime_us = 0;
+  s_vtick_us = 0;
+  clock_gettime(CLOCK_MONOTONIC, &s_origin);
+  s_next = s_origin;
+}
+
+void sc_port_tick_set_period(uint8_t period_ms)
+{
+  s_period = period_ms ? period_ms : 1;
+}
+
+uint8_t sc_port_tick_period(void)
+{
+  return s_period;
+}
+
+uint8_t sc_port_lock(void)
+{
+  return 0;
+}
+
+void sc_port_unlock(uint8_t state)
+{
+  (void)state;
+}
+
+void sc_port_sleep(uint8_t state, uint8_t level)
+{
+  (void)state;
+  (void)level;
+  if (!s_realtime) {
+    if (!sim_match_before_tick()) fire_tick();
+    return;
+  }
+
+  struct timespec tick = s_next;
+  ts_add_us(&tick, (uint64_t)s_period * 1000u);
+  if (s_cmp_armed && s_cmp_due < ts_us(&tick) - ts_us(&s_origin)) {
+    struct timespec due = s_origin;
+    ts_add_us(&due, s_cmp_due);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL) == EINTR) {}
+    fire_match();
+    return;
+  }
+  s_next = tick;
+  // 이미 지난 경계면 즉시 돌아옴 → 밀린 틱을 따라잡는다
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &s_next, NULL) == EINTR) {}
+  fire_tick();
+}
+
+uint32_t sc_port_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)ts_us(&ts);
+}
+
+uint64_t sc_port_time_us(void)
+{
+  if (!s_realtime) return s_vtime_us;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts_us(&ts) - ts_us(&s_origin);
+}
+
+void sc_port_hrt_init(sc_port_tick_fn_t on_match)
+{
+  s_on_match = on_match;
+}
+
+bool sc_port_hrt_arm(uint64_t due_us)
+{
+  if (due_us <= sc_port_time_us()) {
+    s_cmp_armed = false;
+    return false;
+  }
+  s_cmp_due = due_us;
+  s_cmp_armed = true;
+  return true;
+}
+
+void sc_port_hrt_disarm(void)
+{
+  s_cmp_armed = false;
+}
+
+void sc_port_pin_write(uint8_t pin, uint8_t level)
+{
+  uint8_t p = SC_IN_PORT_OF(pin);
+  uint8_t m = (uint8_t)(1u << SC_IN_BIT_OF(pin));
+  s_out[p] = (uint8_t)(level ? (s_out[p] | m) : (s_out[p] & (uint8_t)~m));
+  if (s_pin_sink) s_pin_sink(pin, level);
+}
+
+void sc_port_out_write(const uint8_t* mask, const uint8_t* val)
+{
+  static const uint8_t base[3] = { 0, 8, 14 };
+  for (uint8_t i = 0; i < 3; ++i) {
+    if (!mask[i]) continue;
+    s_out[i] = (uint8_t)((s_out[i] & (uint8_t)~mask[i]) | (val[i] & mask[i]));
+    for (uint8_t b = 0; b < 8; ++b) {
+      if (s_pin_sink && (mask[i] >> b) & 1u) s_pin_sink((uint8_t)(base[i] + b), (uint8_t)((val[i] >> b) & 1u));
+    }
+  }
+}
+
+void sc_port_out_read(uint8_t* port)
+{
+  port[0] = s_out[0];
+  port[1] = s_out[1];
+  port[2] = s_out[2];
+}
+
+void sc_port_in_read(uint8_t* port)
+{
+  port[0] = port[1] = port[2] = 0xFF;
+  if (s_in_source) s_in_source(port);
+}
+
+void sc_port_sim_input_source(sc_port_sim_in_fn_t fn)
+{
+  s_in_source = fn;
+}
+
+void sc_port_sim_pin_sink(sc_port_sim_pin_fn_t fn)
+{
+  s_pin_sink = fn;
+}
+
+void sc_port_sim_tick(void)
+{
+  while (sim_match_before_tick()) {}
+  fire_tick();
+}
+
+void sc_port_sim_fast_forward(uint32_t ms)
+{
+  if (s_realtime || !ms) return;
+  uint64_t end = s_vtick_us + (uint64_t)ms * 1000u;
+  while (s_cmp_armed && s_cmp_due < end) {
+    if (s_cmp_due > s_vtime_us) s_vtime_us = s_cmp_due;
+    fire_match();
+  }
+  s_vtick_us = end;
+  s_vtime_us = end;
+}
+
+void sc_port_sim_realtime(bool on)
+{
+  s_realtime = on;
+  clock_gettime(CLOCK_MONOTONIC, &s_next);
+  s_origin = s_next;
+  s_origin.tv_sec -= (time_t)(s_vtime_us / 1000000u);   // 이미 흐른 가상 시간만큼 원점을 당겨 단조 유지
+  s_origin.tv_nsec -= (long)(s_vtime_us % 1000000u) * 1000L;
+  if (s_origin.tv_nsec < 0) {
+    s_origin.tv_nsec += 1000000000L;
+    s_origin.tv_sec--;
+  }
+}
+
+#endif /* SC_PORT_HOST */
@@ -0,0 +1,143 @@
+/**
+ * @file sched_port_rp2040.c
+ * @brief 스케줄러 포트 — RP2040 (pico SDK / Arduino-Pico)
+ * @details 틱: add_repeating_timer_ms() 음수 지연 = 시작 시각 간격 고정 (콜백 실행 시간만큼 밀리지 않음).
+ *          콜백은 알람 IRQ 컨텍스트에서 실행된다.
+ *          시간축: 1MHz 64비트 하드웨어 타이머 — time_us_64() 가 상위/하위 레지스터를 재시도 읽기하므로
+ *          소프트웨어 확장도 잠금도 필요 없다. 원점만 sc_port_tick_start() 로 맞춘다.
+ *          잠금: PRIMASK 저장/복원 (코어 0 기준 — 코어 1 에서 스케줄러를 돌리면 spin_lock 으로 교체).
+ *          슬립: PRIMASK=1 상태의 WFI 도 대기 IRQ 로 깨어나므로 검사~슬립 사이 경합이 없다.
+ *          dormant/sleep 모드는 시스템 타이머가 멈추므로 DEEP 도 WFI 로 매핑한다.
+ *          비교 타이머: 남는 하드웨어 알람 1개 (1us 해상도, 알람 IRQ 에서 콜백).
+ */
+#include "sched_port.h"
+
+#if SC_PORT_RP2040
+
+#include <stddef.h>
+#include "pico/stdlib.h"
+#include "hardware/timer.h"
+#include "hardware/sync.h"
+#include "hardware/gpio.h"
+
+static sc_port_tick_fn_t s_on_tick;
+static volatile uint8_t  s_period = 1;
+static repeating_timer_t s_timer;
+static bool              s_running;
+static uint64_t          s_origin_us;   // 시간축 원점 (time_us_64 기준)
+static sc_port_tick_fn_t s_on_match;
+static int               s_alarm = -1;  // 비교 타이머용 하드웨어 알람 번호
+
+static bool tick_cb(repeating_timer_t* rt)
+{
+  (void)rt;
+  if (s_on_tick) s_on_tick();
+  return true;   // 계속 반복
+}
+
+void sc_port_tick_start(uint8_t period_ms, sc_port_tick_fn_t on_tick)
+{
+  if (s_running) cancel_repeating_timer(&s_timer);
+  s_on_tick = on_tick;
+  s_period = period_ms ? period_ms : 1;
+  s_origin_us = time_us_64();
+  s_running = add_repeating_timer_ms(-(int32_t)s_period, tick_cb, NULL, &s_timer);
+}
+
+void sc_port_tick_set_period(uint8_t period_ms)
+{
+  uint32_t st = save_and_disable_interrupts();
+  s_period = period_ms ? period_ms : 1;
+  s_timer.delay_us = -(int64_t)s_period * 1000;   // 다음 재장전부터 적용
+  restore_interrupts(st);
+}
+
+uint8_t sc_port_tick_period(void)
+{
+  return s_period;
+}
+
+uint8_t sc_port_lock(void)
+{
+  return (uint8_t)save_and_disable_interrupts();   // PRIMASK (0/1)
+}
+
+void sc_port_unlock(uint8_t state)
+{
+  restore_interrupts(state);
+}
+
+void sc_port_sleep(uint8_t state, uint8_t level)
+{
+  (void)level;
+  __wfi();                   // 잠근 상태에서도 대기 IRQ 로 깨어남
+  restore_interrupts(state); // 해제 시점에 깨운 IRQ 가 실행됨
+}
+
+uint32_t sc_port_us(void)
+{
+  return time_us_32();
+}
+
+uint64_t sc_port_time_us(void)
+{
+  return time_us_64() - s_origin_us;
+}
+
+static void alarm_cb(uint alarm_num)
+{
+  (void)alarm_num;
+  if (s_on_match) s_on_match();
+}
+
+void sc_port_hrt_init(sc_port_tick_fn_t on_match)
+{
+  s_on_match = on_match;
+  if (s_alarm < 0) {
+    s_alarm = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback((uint)s_alarm, alarm_cb);
+  }
+}
+
+bool sc_port_hrt_arm(uint64_t due_us)
+{
+  // true = 이미 지난 시각 (알람 미설정)
+  return !hardware_alarm_set_target((uint)s_alarm, from_us_since_boot(due_us + s_origin_us));
+}
+
+void sc_port_hrt_disarm(void)
+{
+  hardware_alarm_cancel((uint)s_alarm);
+}
+
+void sc_port_pin_write(uint8_t pin, uint8_t level)
+{
+  gpio_put(pin, level);   // SIO SET/CLR 레지스터 — 원자적
+}
+
+void sc_port_in_read(uint8_t* port)
+{
+  // GP0-19 를 Uno 핀 번호와 같은 위치에 배치 → SC_IN_PORT_OF/BIT_OF 그대로 사용
+  uint32_t all = gpio_get_all();
+  port[0] = (uint8_t)all;          // GP0-7
+  port[1] = (uint8_t)(all >> 8);   // GP8-13
+  port[2] = (uint8_t)(all >> 14);  // GP14-19
+}
+
+void sc_port_out_write(const uint8_t* mask, const uint8_t* val)
+{
+  // 세 포트를 GPIO 32비트 하나로 모아 SIO XOR 1회 → 모든 엣지가 같은 사이클
+  uint32_t m = (uint32_t)mask[0] | ((uint32_t)mask[1] << 8) | ((uint32_t)mask[2] << 14);
+  uint32_t v = (uint32_t)val[0]  | ((uint32_t)val[1]  << 8) | ((uint32_t)val[2]  << 14);
+  gpio_put_masked(m, v);
+}
+
+void sc_port_out_read(uint8_t* port)
+{
+  uint32_t all = sio_hw->gpio_out;
+  port[0] = (uint8_t)all;
+  port[1] = (uint8_t)(all >> 8);
+  port[2] = (uint8_t)(all >> 14);
+}
+
+#endif /* SC_PORT_RP2040 */
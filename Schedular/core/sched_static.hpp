@@ -0,0 +1,131 @@
+/**
+ * @file sched_static.hpp
+ * @brief 컴파일 타임 주기 태스크 목록 + 인라인 디스패치 (C++17, 헤더 전용, 선택 사항)
+ * @details 기존 디스패치 경로(g_tasks_10ms[i](), drv->task_fn(), 슬롯 fn)는 모두 함수 포인터
+ *          간접 호출이라 인라인이 막히고 테이블이 RAM/플래시를 쓴다. 주기 태스크 집합이
+ *          빌드 시점에 고정이면 태스크를 타입 목록으로 선언해 디스패치를 컴파일러가 펼치게 한다.
+ *          - 태스크 = sc_static_task<함수, 주기, 위상> — 함수는 템플릿 인자 → 직접 호출
+ *            (같은 번역 단위에 정의가 보이면 인라인, extern "C" 태스크도 그대로 사용)
+ *          - 하이퍼피리어드(주기들의 최소공배수 / 틱)와 태스크별 주기/위상 나머지는 상수
+ *            → 런타임 상태는 프레임 카운터 1개, 테이블/슬롯 없음
+ *          - 틱 주기와 같은 주기의 태스크는 검사 없이 매 프레임 호출
+ *
+ *          sched_core 의 동적 슬롯(1회성/워크/코루틴)은 그대로 쓰고, 고정 주기 태스크만 옮긴다.
+ *          스택 계측은 태스크 단위가 아니라 프레임 단위 — sc_call_measured() 에 run 을
+ *          감싼 함수 하나를 넘긴다.
+ *
+ *          AVR-GCC 는 기본이 -std=gnu++11 이므로 platform.local.txt 등에서 -std=gnu++17 로 올려야 한다.
+ *          STL 없이 <stdint.h> 만 사용 (avr-libc 호환).
+ *
+ * @code
+ *   extern "C" void fault_input_10ms_task(void);   // C 번역 단위의 태스크
+ *
+ *   using frame_t = sc_static_sched<10,
+ *       sc_static_task<fault_input_10ms_task, 10>,
+ *       sc_static_task<t50_adc, 50>,
+ *       sc_static_task<t50_log, 50, 10>>;          // 50ms 주기, 10ms 위상 지연
+ *
+ *   // 10ms 틱마다
+ *   frame_t::tick();
+ * @endcode
+ */
+#ifndef SCHED_STATIC_HPP
+#define SCHED_STATIC_HPP
+
+#if !defined(__cplusplus) || __cplusplus < 201703L
+#error "sched_static.hpp requires C++17 (-std=gnu++17)"
+#endif
+
+#include <stdint.h>
+
+/* ===== 컴파일 타임 정수 유틸 (STL 대신) ===== */
+constexpr uint32_t sc_static_gcd(uint32_t a, uint32_t b) {
+  return b ? sc_static_gcd(b, a % b) : a;
+}
+
+constexpr uint32_t sc_static_lcm(uint32_t a, uint32_t b) {
+  return a / sc_static_gcd(a, b) * b;
+}
+
+/**
+ * @brief 주기 태스크 선언
+ * @tparam Fn       태스크 함수 (void(void), C/C++ 링키지 무관)
+ * @tparam PeriodMs 주기 (틱 주기의 배수)
+ * @tparam OffsetMs 위상 (0 ~ PeriodMs 미만, 틱 주기의 배수) — 부하 평준화용
+ */
+template <void (*Fn)(void), uint16_t PeriodMs, uint16_t OffsetMs = 0>
+struct sc_static_task {
+  static_assert(PeriodMs > 0, "PeriodMs must be > 0");
+  static_assert(OffsetMs < PeriodMs, "OffsetMs must be < PeriodMs");
+
+  static constexpr uint16_t period_ms = PeriodMs;
+  static constexpr uint16_t offset_ms = OffsetMs;
+
+  static inline void call() { Fn(); }
+};
+
+/**
+ * @brief 컴파일 타임 태스크 목록 디스패처
+ * @tparam TickMs 프레임(호출) 주기
+ * @tparam Tasks  sc_static_task<...> 목록 — 선언 순서대로 실행
+ */
+template <uint16_t TickMs, class... Tasks>
+class sc_static_sched {
+  static_assert(TickMs > 0, "TickMs must be > 0");
+  static_assert(sizeof...(Tasks) > 0, "empty task list");
+  static_assert((((Tasks::period_ms % TickMs) == 0) && ...), "period must be a multiple of TickMs");
+  static_assert((((Tasks::offset_ms % TickMs) == 0) && ...), "offset must be a multiple of TickMs");
+
+  static constexpr uint32_t lcm_all() {
+    uint32_t l = 1;
+    ((l = sc_static_lcm(l, Tasks::period_ms)), ...);
+    return l;
+  }
+
+public:
+  static constexpr uint16_t tick_ms = TickMs;
+  static constexpr uint16_t task_count = sizeof...(Tasks);
+  static constexpr uint32_t hyper_ms = lcm_all();               ///< 하이퍼피리어드 (ms)
+  static constexpr uint32_t frame_count = hyper_ms / TickMs;    ///< 하이퍼피리어드 프레임 수
+  static_assert(frame_count <= 0xFFFFu, "hyperperiod too long for 16-bit frame counter");
+
+  /**
+   * @brief 프레임 번호 기준 실행 (외부 프레임 카운터 — 예: 틱 ISR 이 넘겨준 마이너 프레임)
+   * @param f 0 ~ frame_count-1
+   */
+  static inline void run(uint16_t f) {
+    (run_one<Tasks>(f), ...);
+  }
+
+  /**
+   * @brief 내부 프레임 카운터로 실행 후 다음 프레임으로 (TickMs 마다 호출)
+   */
+  static inline void tick() {
+    run(s_frame);
+    if (++s_frame >= frame_count) s_frame = 0;
+  }
+
+  /** @brief 다음 tick() 이 실행할 프레임 */
+  static inline uint16_t frame() { return s_frame; }
+
+  /** @brief 프레임 카운터를 0 으로 (모든 태스크 위상 원점) */
+  static inline void reset() { s_frame = 0; }
+
+private:
+  template <class T>
+  static inline void run_one(uint16_t f) {
+    constexpr uint16_t every = T::period_ms / TickMs;
+    constexpr uint16_t phase = T::offset_ms / TickMs;
+    if constexpr (every == 1) {
+      T::call();
+    } else if constexpr (frame_count == every) {   // 주기 = 하이퍼피리어드 → 나머지 불필요
+      if (f == phase) T::call();
+    } else {
+      if (f % every == phase) T::call();
+    }
+  }
+
+  static inline uint16_t s_frame = 0;
+};
+
+#endif // SCHED_STATIC_HPP
@@ -0,0 +1,246 @@
+/**
+ * @file sched_sync.c
+ * @brief 보드 간 시각 동기 구현
+ */
+
+#include "sched_sync.h"
+#include "sched_port.h"
+
+#define SYNC_TURN_INVALID 0xFFFFu   // 마스터 처리 시간이 u16 us 를 넘음 → 표본 무효
+
+/* ===== little endian 필드 ===== */
+
+static void put_u16(uint8_t* p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t* p, uint32_t v) {
+  put_u16(p, (uint16_t)v);
+  put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+static uint16_t get_u16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t* p) {
+  return get_u16(p) | ((uint32_t)get_u16(p + 2) << 16);
+}
+
+/* ===== 라운드 ===== */
+
+static void send_req(sc_sync_t* s, sc_time_t now) {
+  uint8_t d[SC_SYNC_REQ_LEN];
+  if (s->idx == 0) s->t_next = now + SC_TIME_MS(s->period_ms);  // 라운드 시작 기준 격자
+  d[0] = s->round;
+  d[1] = s->idx;
+  put_u32(&d[2], (uint32_t)now);
+  for (uint8_t i = 6; i < SC_SYNC_REQ_LEN; ++i) d[i] = 0;
+  s->idx++;
+  s->wait = 1;
+  s->t_req = now;
+  s->send(d, sizeof(d));
+}
+
+/* 기준점 오프셋 + 드리프트 외삽 (us) */
+static int64_t est_at(const sc_sync_t* s, sc_time_t t) {
+  return s->off_us + (int64_t)s->drift_ppb * (int64_t)((t - s->off_t) / 1000u) / 1000000;
+}
+
+static void drift_anchor(sc_sync_t* s) {
+  s->drift_off = s->best_off;
+  s->drift_t = s->best_t;
+  s->drift_k = 0;
+}
+
+/* 라운드 최소 RTT 표본 채택 → 기준점 갱신 (+ SC_SYNC_DRIFT_ROUNDS 마다 드리프트 표본) */
+static void round_end(sc_sync_t* s) {
+  uint32_t rtt = s->best_rtt;
+  s->idx = 0;
+  s->round++;
+  s->best_rtt = UINT32_MAX;
+  if (rtt == UINT32_MAX) return;   // 유효 응답 없음 (타임아웃/버림은 이미 집계)
+
+  int64_t lim = (int64_t)s->step_ms * 1000;
+  int64_t d = (s->state == SC_SYNC_LOCKED) ? s->best_off - est_at(s, s->best_t) : lim;
+
+  if (d >= lim || -d >= lim) {
+    // 첫 잠금 / 스텝급 변화(마스터 재부팅 등) — 표본으로 기준점 재설정, 드리프트는 발진자 몫이라 유지
+    s->off_us = s->best_off;
+    drift_anchor(s);
+  } else {
+    // 예측과의 차이를 절반만 반영 → 라운드 표본 잡음 완화
+    s->off_us = est_at(s, s->best_t) + d / 2;
+    // 첫 표본은 1/4 기준선으로 빨리 (큰 드리프트를 슬루만으로 쫓는 구간을 줄임)
+    if (++s->drift_k >= (s->drift_n ? SC_SYNC_DRIFT_ROUNDS : SC_SYNC_DRIFT_ROUNDS / 4)) {
+      // 드리프트는 긴 기준선의 원시 표본 차로 (1초 기준선이면 표본 잡음 ±0.5ms 가 ±500ppm)
+      int64_t ppb = (s->best_off - s->drift_off) * 1000000000 / (int64_t)(s->best_t - s->drift_t);
+      if (ppb > SC_SYNC_DRIFT_MAX_PPM * 1000LL || ppb < -SC_SYNC_DRIFT_MAX_PPM * 1000LL) {
+        s->rejected++;
+      } else {
+        if (s->drift_n == 0) s->drift_ppb = (int32_t)ppb;
+        else                 s->drift_ppb += (int32_t)((ppb - s->drift_ppb) / 4);
+        if (s->drift_n < 255) s->drift_n++;
+      }
+      drift_anchor(s);
+    }
+  }
+
+  s->off_t = s->best_t;
+  s->last_rtt = rtt;
+  s->state = SC_SYNC_LOCKED;
+  s->rounds++;
+}
+
+/* 목표 오프셋(추정 + 드리프트 외삽)으로 적용 오프셋을 ±1ms 씩, 또는 스텝으로 이동 */
+static int slew(sc_sync_t* s, sc_time_t now) {
+  if (s->state != SC_SYNC_LOCKED) return 0;
+
+  int64_t err_us = est_at(s, now) - (int64_t)s->ofs_ms * 1000;
+  int32_t err = (int32_t)((err_us >= 0 ? err_us + 500 : err_us - 500) / 1000);
+
+  if (s->steps == 0 || err >= (int32_t)s->step_ms || -err >= (int32_t)s->step_ms) {
+    uint8_t st = sc_port_lock();
+    s->ofs_ms += err;
+    s->restamp = 1;
+    sc_port_unlock(st);
+    s->err_ms = 0;
+    s->steps++;
+    return 1;
+  }
+
+  s->err_ms = err;
+  // 반올림 경계(0.5ms) 근처 표본 잡음으로 ±1 을 오가지 않도록 데드밴드
+  if (err_us < SC_SYNC_DEADBAND_US && -err_us < SC_SYNC_DEADBAND_US) return 0;
+  uint32_t now_ms = (uint32_t)(now / 1000u);
+  if ((uint32_t)(now_ms - s->slew_at_ms) < s->slew_ms) return 0;
+  s->slew_at_ms = now_ms;
+
+  int32_t d = (err_us > 0) ? 1 : -1;
+  uint8_t st = sc_port_lock();
+  s->ofs_ms += d;
+  sc_port_unlock(st);
+  s->err_ms -= d;
+  s->slews++;
+  return 0;
+}
+
+/* ===== API ===== */
+
+int sc_sync_init(sc_sync_t* s, sc_sync_send_fn_t send, uint16_t period_ms, uint8_t burst,
+                 uint16_t slew_ms, uint16_t step_ms) {
+  if (!s || !send || period_ms == 0 || burst == 0 || slew_ms == 0 || step_ms <= slew_ms) return -2;
+
+  s->send = send;
+  s->period_ms = period_ms;
+  s->slew_ms = slew_ms;
+  s->step_ms = step_ms;
+  s->burst = burst;
+  s->state = SC_SYNC_UNSYNC;
+  s->round = 0;
+  s->idx = 0;
+  s->wait = 0;
+  s->restamp = 1;
+  s->t_req = 0;
+  s->t_next = 0;
+  s->best_rtt = UINT32_MAX;
+  s->best_off = 0;
+  s->best_t = 0;
+  s->off_us = 0;
+  s->off_t = 0;
+  s->drift_off = 0;
+  s->drift_t = 0;
+  s->drift_ppb = 0;
+  s->drift_k = 0;
+  s->drift_n = 0;
+  s->ofs_ms = 0;
+  s->err_ms = 0;
+  s->last_stamp = 0;
+  s->slew_at_ms = 0;
+  s->last_rtt = 0;
+  s->rounds = 0;
+  s->samples = 0;
+  s->timeouts = 0;
+  s->rejected = 0;
+  s->steps = 0;
+  s->slews = 0;
+  return 0;
+}
+
+int sc_sync_poll(sc_sync_t* s, sc_time_t now_us) {
+  if (s->wait && now_us - s->t_req >= SC_TIME_MS(SC_SYNC_TIMEOUT_MS)) {
+    s->wait = 0;
+    s->timeouts++;
+  }
+  if (!s->wait) {
+    if (s->idx >= s->burst)                  round_end(s);
+    else if (s->idx > 0 || now_us >= s->t_next) send_req(s, now_us);
+  }
+  return slew(s, now_us);
+}
+
+int sc_sync_input(sc_sync_t* s, const uint8_t* data, uint8_t len, sc_time_t rx_us) {
+  if (len != SC_SYNC_RESP_LEN || !s->wait || data[0] != s->round || data[1] != (uint8_t)(s->idx - 1)) {
+    s->rejected++;
+    return -1;
+  }
+  s->wait = 0;
+  s->samples++;
+
+  // t1 은 하위 32비트만 왕복 → t4 기준으로 64비트 복원 (왕복 71분 미만)
+  uint32_t up = (uint32_t)rx_us - get_u32(&data[2]);   // t4 - t1
+  sc_time_t t1 = rx_us - up;
+  sc_time_t t2 = 0;
+  for (uint8_t i = 8; i--;) t2 = (t2 << 8) | data[6 + i];
+  uint16_t turn = get_u16(&data[14]);                  // t3 - t2
+
+  if (turn == SYNC_TURN_INVALID || up < turn || up - turn > SC_SYNC_RTT_MAX_US) {
+    s->rejected++;
+    return -1;
+  }
+  uint32_t rtt = up - turn;
+  if (rtt < s->best_rtt) {
+    s->best_rtt = rtt;
+    s->best_off = (int64_t)(t2 - t1) - (int64_t)(rtt / 2);
+    s->best_t = t1 + up / 2;
+  }
+  return 0;
+}
+
+uint32_t sc_sync_stamp(sc_sync_t* s, uint32_t local_ms) {
+  uint8_t st = sc_port_lock();
+  uint32_t v = local_ms + (uint32_t)s->ofs_ms;
+  if (s->restamp) s->restamp = 0;
+  else if ((int32_t)(v - s->last_stamp) < 0) v = s->last_stamp;   // 뒤로 보정 중 → 멈춤
+  s->last_stamp = v;
+  sc_port_unlock(st);
+  return v;
+}
+
+uint8_t sc_sync_answer(const uint8_t* req, uint8_t len, sc_time_t rx_us, sc_time_t tx_us, uint8_t* out) {
+  if (!req || !out || len != SC_SYNC_REQ_LEN) return 0;
+  sc_time_t turn = tx_us - rx_us;
+
+  for (uint8_t i = 0; i < 6; ++i) out[i] = req[i];     // round, idx, t1 그대로
+  for (uint8_t i = 0; i < 8; ++i) out[6 + i] = (uint8_t)(rx_us >> (8 * i));
+  put_u16(&out[14], (turn >= SYNC_TURN_INVALID) ? SYNC_TURN_INVALID : (uint16_t)turn);
+  return SC_SYNC_RESP_LEN;
+}
+
+void sc_sync_get_stats(const sc_sync_t* s, sc_sync_stats_t* out) {
+  if (!out) return;
+  uint8_t st = sc_port_lock();
+  out->ofs_ms = s->ofs_ms;
+  sc_port_unlock(st);
+  out->state = s->state;
+  out->err_ms = s->err_ms;
+  out->drift_ppb = s->drift_ppb;
+  out->rtt_us = s->last_rtt;
+  out->rounds = s->rounds;
+  out->samples = s->samples;
+  out->timeouts = s->timeouts;
+  out->rejected = s->rejected;
+  out->steps = s->steps;
+  out->slews = s->slews;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file sched_sync.h
+ * @brief 보드 간 시각 동기 — 마스터 기준 오프셋/드리프트 추정 + 완만한 슬루 시각축
+ * @details 보드마다 g_tick_ms 가 따로 돌고 발진자 오차(수십~수천 ppm)로 벌어지므로,
+ *          여러 보드의 Fault/트레이스 기록을 시각으로 맞춰 보려면 공통 시각축이 필요하다.
+ *          슬레이브가 마스터에게 4-타임스탬프 교환(NTP 방식)을 요청해 오프셋과 드리프트를 추정하고,
+ *          로컬 틱 + 적용 오프셋(ms)으로 동기 시각을 낸다.
+ *          - 교환: t1(요청 송신, 로컬) → t2(수신)/t3(응답 송신, 마스터) → t4(응답 수신, 로컬)
+ *            RTT = (t4 - t1) - (t3 - t2), 오프셋 = (t2 - t1) - RTT/2  (마스터 - 로컬, us)
+ *          - 라운드: period_ms 마다 burst 회 교환을 연달아 (응답 → 다음 요청) 하고 RTT 최소 표본만 채택
+ *            → 트래픽은 라운드에 몰리고, 라운드 사이에는 링크가 조용하다
+ *          - 추정: 기준점 = 예측(드리프트 외삽)과 표본의 중간 — 라운드 표본 잡음을 절반으로
+ *          - 드리프트: SC_SYNC_DRIFT_ROUNDS 라운드 기준선의 오프셋 변화율 (ppb, 지수 평균) → 외삽
+ *          - 시각축: 적용 오프셋은 slew_ms 마다 최대 ±1ms 만 움직인다 (최대 슬루율 = 1/slew_ms).
+ *            동기 시각은 단조 비감소 — 뒤로 보정할 때는 잠시 멈춘다.
+ *            처음 잠길 때와 오차가 step_ms 이상일 때(마스터 재부팅 등)만 한 번에 맞춘다 (스텝)
+ *          - 스케줄러 주기와 무관: g_tick_ms/슬롯 마감은 로컬 그대로, 동기 시각은 기록 스탬프에만 쓴다
+ *
+ *          전송과 시간은 호출자가 준다 (하드웨어 의존 없음):
+ *          슬레이브는 idle 에서 sc_sync_poll(), 응답 수신 시 sc_sync_input() — 요청은 send 콜백으로 나간다.
+ *          마스터는 요청을 받으면 sc_sync_answer() 로 응답을 만든다 (인스턴스 불필요).
+ *          프레이밍(COBS/CRC)은 전송 계층 몫 — 샘플 프로젝트는 텔레메트리 프레임(TLM_CMD_SYNC)에 싣는다.
+ *          시각 인자는 sc_time_us() 시간축 (틱 카운터와 같은 원점, sched_time.h) 이어야 한다.
+ *
+ *          64비트 연산(오프셋/외삽 나눗셈)은 sc_sync_poll()/sc_sync_input() (idle) 에서만 하고,
+ *          ISR 에서도 부르는 sc_sync_stamp() 는 32비트 덧셈/비교뿐이다.
+ */
+#ifndef SCHED_SYNC_H
+#define SCHED_SYNC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sched_time.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SC_SYNC_TIMEOUT_MS
+#define SC_SYNC_TIMEOUT_MS   100u     ///< 응답 대기 한도 — 넘으면 그 교환은 버리고 다음 요청
+#endif
+#ifndef SC_SYNC_RTT_MAX_US
+#define SC_SYNC_RTT_MAX_US   50000u   ///< 이보다 긴 RTT 표본은 채택하지 않음 (오차 한계 = RTT/2)
+#endif
+#ifndef SC_SYNC_DRIFT_ROUNDS
+#define SC_SYNC_DRIFT_ROUNDS 16       ///< 드리프트 표본 기준선 (채택 라운드 수)
+#endif
+#ifndef SC_SYNC_DEADBAND_US
+#define SC_SYNC_DEADBAND_US  750      ///< 남은 보정이 이 미만이면 슬루하지 않음 (±1ms 떨림 방지)
+#endif
+#ifndef SC_SYNC_DRIFT_MAX_PPM
+#define SC_SYNC_DRIFT_MAX_PPM 20000   ///< 드리프트 표본 한계 — 넘으면 이상치로 버림
+#endif
+
+/* 요청도 응답과 같은 길이로 채운다 — 직렬 전송 시간이 양방향 같아야 오프셋이 한쪽으로 치우치지 않음 */
+#define SC_SYNC_REQ_LEN      16u      ///< 요청 data: u8 round, u8 idx, u32 t1 (로컬 하위 32비트), 0 × 10
+#define SC_SYNC_RESP_LEN     16u      ///< 응답 data: u8 round, u8 idx, u32 t1, u64 t2, u16 t3-t2
+
+/* ===== 상태 ===== */
+#define SC_SYNC_UNSYNC       0        ///< 아직 채택한 라운드 없음 — 동기 시각 = 로컬 틱
+#define SC_SYNC_LOCKED       1        ///< 마스터 기준 추정 중
+
+/**
+ * @brief 요청 송신 콜백 (전송 계층이 프레임으로 감싸 보냄)
+ * @param data SC_SYNC_REQ_LEN 바이트
+ */
+typedef void (*sc_sync_send_fn_t)(const uint8_t* data, uint8_t len);
+
+/**
+ * @brief 슬레이브 인스턴스 (호출자 소유, 정적 할당)
+ */
+typedef struct {
+  /* 설정 */
+  sc_sync_send_fn_t send;
+  uint16_t period_ms;     ///< 라운드 간격
+  uint16_t slew_ms;       ///< ±1ms 보정 최소 간격 (로컬 ms)
+  uint16_t step_ms;       ///< 오차가 이 이상이면 슬루 대신 스텝
+  uint8_t  burst;         ///< 라운드당 교환 수
+  /* 라운드 진행 */
+  uint8_t  state;         ///< SC_SYNC_xxx
+  uint8_t  round;         ///< 라운드 번호 (응답 매칭)
+  uint8_t  idx;           ///< 이번 라운드에 보낸 요청 수
+  uint8_t  wait;          ///< 응답 대기 중
+  uint8_t  restamp;       ///< 스텝 직후 — 다음 스탬프는 단조 클램프 없이 새 시각축에서 시작
+  sc_time_t t_req;        ///< 마지막 요청 시각
+  sc_time_t t_next;       ///< 다음 라운드 시작 시각
+  uint32_t best_rtt;      ///< 이번 라운드 최소 RTT (us)
+  int64_t  best_off;      ///< 그 표본의 오프셋 (us)
+  sc_time_t best_t;       ///< 그 표본의 로컬 시각 (t1, t4 중점)
+  /* 추정 */
+  int64_t  off_us;        ///< 기준점 오프셋 (마스터 - 로컬, 라운드마다 필터)
+  sc_time_t off_t;        ///< 기준점 로컬 시각
+  int64_t  drift_off;     ///< 드리프트 기준선 시작 표본 (원시 오프셋)
+  sc_time_t drift_t;
+  int32_t  drift_ppb;     ///< 마스터 대비 로컬 속도 오차 (+ = 로컬이 느림)
+  uint8_t  drift_k;       ///< 기준선 시작 이후 채택 라운드 수
+  uint8_t  drift_n;       ///< 드리프트 표본 수 (포화 255)
+  /* 시각축 */
+  volatile int32_t ofs_ms;  ///< 적용 오프셋 — 동기 시각 = 로컬 틱 + ofs_ms
+  int32_t  err_ms;        ///< 남은 보정량 (목표 - 적용)
+  uint32_t last_stamp;    ///< 마지막 동기 스탬프 (단조 클램프)
+  uint32_t slew_at_ms;    ///< 마지막 ±1ms 보정 시각 (로컬 ms)
+  /* 계측 */
+  uint32_t last_rtt;      ///< 마지막 채택 라운드 RTT (us)
+  uint16_t rounds;        ///< 채택한 라운드 수
+  uint16_t samples;       ///< 받은 응답 수
+  uint16_t timeouts;      ///< 응답 타임아웃 수
+  uint16_t rejected;      ///< 버린 표본/라운드 수 (RTT 초과, 드리프트 이상치, 짝 안 맞는 응답)
+  uint16_t steps;         ///< 스텝 수 (첫 잠금 포함)
+  uint16_t slews;         ///< ±1ms 보정 수
+} sc_sync_t;
+
+/**
+ * @brief 계측 스냅샷
+ */
+typedef struct {
+  uint8_t  state;
+  int32_t  ofs_ms;        ///< 적용 오프셋
+  int32_t  err_ms;        ///< 남은 보정량
+  int32_t  drift_ppb;
+  uint32_t rtt_us;        ///< 마지막 채택 라운드 RTT
+  uint16_t rounds;
+  uint16_t samples;
+  uint16_t timeouts;
+  uint16_t rejected;
+  uint16_t steps;
+  uint16_t slews;
+} sc_sync_stats_t;
+
+/**
+ * @brief 슬레이브 초기화 (UNSYNC, 첫 라운드는 다음 sc_sync_poll())
+ * @param send      요청 송신 콜백
+ * @param period_ms 라운드 간격 (예: 1000)
+ * @param burst     라운드당 교환 수 (1 이상, 예: 4)
+ * @param slew_ms   ±1ms 보정 최소 간격 (예: 100 → 최대 1% — 발진자 드리프트보다 커야 따라감)
+ * @param step_ms   스텝 기준 오차 (slew_ms 보다 큰 값, 예: 500)
+ * @return 0: 성공, -2: 잘못된 파라미터
+ */
+int sc_sync_init(sc_sync_t* s, sc_sync_send_fn_t send, uint16_t period_ms, uint8_t burst,
+                 uint16_t slew_ms, uint16_t step_ms);
+
+/**
+ * @brief 라운드 진행 + 슬루 (idle 에서 호출)
+ * @param now_us sc_time_us()
+ * @return 1: 이번 호출에서 시각축을 스텝함 (이후 스탬프는 새 시각축 — 로그에 표시할 것), 0: 그 외
+ */
+int sc_sync_poll(sc_sync_t* s, sc_time_t now_us);
+
+/**
+ * @brief 응답 1개 처리 (수신 직후, idle/메인 루프 문맥)
+ * @param data  응답 data (SC_SYNC_RESP_LEN 바이트)
+ * @param rx_us 응답 수신 시각 t4 (sc_time_us())
+ * @return 0: 표본 반영, -1: 버림 (길이/라운드 불일치, 대기 중 아님, RTT 초과)
+ */
+int sc_sync_input(sc_sync_t* s, const uint8_t* data, uint8_t len, sc_time_t rx_us);
+
+/**
+ * @brief 동기 시각 (ms) — 로그 스탬프용 (ISR-safe)
+ * @param local_ms 현재 로컬 틱 (g_tick_ms)
+ * @return 마스터 시간축 ms (UNSYNC 면 로컬 틱), 스텝 사이에서는 단조 비감소
+ */
+uint32_t sc_sync_stamp(sc_sync_t* s, uint32_t local_ms);
+
+/**
+ * @brief 마스터 쪽 응답 생성
+ * @param req   요청 data
+ * @param rx_us 요청 수신 시각 t2 (마스터의 sc_time_us())
+ * @param tx_us 응답 송신 시각 t3 (보내기 직전)
+ * @param out   최소 SC_SYNC_RESP_LEN 바이트
+ * @return 응답 길이, 0: 잘못된 요청
+ */
+uint8_t sc_sync_answer(const uint8_t* req, uint8_t len, sc_time_t rx_us, sc_time_t tx_us, uint8_t* out);
+
+/**
+ * @brief 계측 값 조회
+ */
+void sc_sync_get_stats(const sc_sync_t* s, sc_sync_stats_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_SYNC_H
@@ -0,0 +1,49 @@
+/**
+ * @file sched_time.h
+ * @brief 64비트 단조 us 시간축
+ * @details 32비트 ms 틱 카운터(g_tick_ms)는 약 49.7일에 래핑하고 1ms 미만을 표현하지 못한다.
+ *          sc_time_us() 는 포트의 하드웨어 카운터 + 오버플로 확장으로 64비트 us 를 돌려준다.
+ *          - 원점: sc_port_tick_start() 시점 = 0 → 0 에서 시작하는 틱 카운터와 같은 원점
+ *            (틱 카운터 ms == sc_time_us() / 1000 을 틱 주기 이내로 따라감)
+ *          - 래핑 없음 (약 58만 년) → 비교는 일반 부등호
+ *          - 읽기는 잠금 없음: AVR 은 ISR 순번 재시도, RP2040 은 64비트 하드웨어 타이머,
+ *            호스트는 clock_gettime (가상 시간 모드는 틱마다 전진)
+ *
+ *          스케줄러 슬롯은 32비트 틱으로 유지한다 (AVR 에서 슬롯당 +4바이트, 64비트 비교 비용).
+ *          us 마감은 등록 시 sc_time_to_tick() 으로 그 시각 이후 첫 틱 경계로 올림 변환한다
+ *          → sc_add_at_us() / sc_add0_at_us().
+ */
+#ifndef SCHED_TIME_H
+#define SCHED_TIME_H
+
+#include <stdint.h>
+#include "sched_port.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint64_t sc_time_t;   ///< us (sc_port_tick_start() 기준)
+
+#define SC_TIME_MS(ms) ((sc_time_t)(ms) * 1000u)
+
+/**
+ * @brief 현재 시각 (us)
+ */
+static inline sc_time_t sc_time_us(void) {
+  return sc_port_time_us();
+}
+
+/**
+ * @brief us 시각 → 틱 시각 (ms, 올림 — 해당 시각 이전에는 실행되지 않음)
+ * @note  64비트 나눗셈 — AVR 에서는 등록 경로에서만 사용
+ */
+static inline uint32_t sc_time_to_tick(sc_time_t t) {
+  return (uint32_t)((t + 999u) / 1000u);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCHED_TIME_H
@@ -1,5 +1,6 @@
 /* adc_driver.c */
 #include "adc_driver.h"
+#include "adc_dsp.h"
 #include <Arduino.h>
 
 // 외부 스케줄러 변수
@@ -10,14 +11,31 @@ extern volatile uint32_t g_tick_ms;
 #define ADC_PIN A0
 #endif
 
+// 후처리 파라미터
+#define ADC_DSP_MEDIAN_N  5     // 스파이크 제거 창 (샘플)
+#define ADC_DSP_EMA_SHIFT 3     // 알파 = 1/8
+#define ADC_DSP_HIST      32    // 원시 샘플 링 (2의 거듭제곱)
+#ifndef ADC_DSP_WINDOW
+#define ADC_DSP_WINDOW    20    // 통계 창 = 20 × 50ms = 1초
+#endif
+
+// 주기적 로그 출력 간격 (ms)
+#ifndef ADC_LOG_INTERVAL_MS
+#define ADC_LOG_INTERVAL_MS 1000
+#endif
+
 // ADC 드라이버 내부 상태
 static struct {
   adc_data_t current_data;    // 현재 ADC 데이터
-  float ref_voltage;          // 참조 전압
-  uint8_t adc_pin;            // 사용할 ADC 핀
   uint32_t sample_count;      // 총 샘플 수
   uint32_t last_log_ms;       // 마지막 로그 출력 시간
-  uint16_t log_interval_ms;   // 로그 출력 간격
+  uint16_t ref_mv;            // 참조 전압 (mV)
+  uint8_t adc_pin;            // 사용할 ADC 핀
+  dsp_median_t median;        // 스파이크 제거
+  dsp_ema_t ema;              // 평활
+  dsp_roc_t roc;              // 변화율
+  dsp_ring_t hist;            // 원시 샘플 창
+  int16_t hist_buf[ADC_DSP_HIST];
 } adc_ctx;
 
 int adc_driver_init(void)
@@ -31,16 +49,20 @@ int adc_driver_init(void)
   adc_ctx.current_data.timestamp_ms = 0;
   adc_ctx.current_data.valid = 0;
   
-  adc_ctx.ref_voltage = 5.0f;         // 기본 5V 참조
+  adc_ctx.ref_mv = 5000;              // 기본 5V 참조
   adc_ctx.adc_pin = ADC_PIN;
   adc_ctx.sample_count = 0;
   adc_ctx.last_log_ms = 0;
-  adc_ctx.log_interval_ms = 1000;     // 1초마다 로그
+
+  dsp_median_init(&adc_ctx.median, ADC_DSP_MEDIAN_N);
+  dsp_ema_init(&adc_ctx.ema, ADC_DSP_EMA_SHIFT);
+  dsp_roc_init(&adc_ctx.roc);
+  dsp_ring_init(&adc_ctx.hist, adc_ctx.hist_buf, ADC_DSP_HIST);
   
   Serial.print(F("[ADC] Driver initialized - Pin A"));
   Serial.print(adc_ctx.adc_pin - A0);
   Serial.print(F(", Ref: "));
-  Serial.print(adc_ctx.ref_voltage);
+  Serial.print(adc_ctx.ref_mv / 1000.0f);
   Serial.println(F("V"));
   
   return 0;
@@ -56,7 +78,7 @@ void adc_driver_task(void)
   uint16_t raw_value = analogRead(adc_ctx.adc_pin);
   
   // 전압으로 변환 (10비트 ADC: 0-1023)
-  float voltage = (raw_value * adc_ctx.ref_voltage) / 1024.0f;
+  float voltage = ((uint32_t)raw_value * adc_ctx.ref_mv) / 1024000.0f;
   
   // 데이터 업데이트
   adc_ctx.current_data.raw = raw_value;
@@ -64,16 +86,29 @@ void adc_driver_task(void)
   adc_ctx.current_data.timestamp_ms = now;
   adc_ctx.current_data.valid = 1;
   adc_ctx.sample_count++;
+
+  // 후처리 (고정소수점, 힙 없음)
+  int16_t filtered = dsp_ema_push(&adc_ctx.ema, dsp_median_push(&adc_ctx.median, (int16_t)raw_value));
+  dsp_stats_t win;
+  dsp_ring_push(&adc_ctx.hist, (int16_t)raw_value);
+  dsp_ring_stats(&adc_ctx.hist, ADC_DSP_WINDOW, &win);
+  adc_ctx.current_data.filtered = (uint16_t)filtered;
+  adc_ctx.current_data.roc_per_s = dsp_roc_push(&adc_ctx.roc, filtered, now);
+  adc_ctx.current_data.win_min = (uint16_t)win.min;
+  adc_ctx.current_data.win_max = (uint16_t)win.max;
+  adc_ctx.current_data.win_rms = win.rms;
   
   // 주기적 로그 출력 (1초마다)
-  if (now - adc_ctx.last_log_ms >= adc_ctx.log_interval_ms) {
+  if (now - adc_ctx.last_log_ms >= ADC_LOG_INTERVAL_MS) {
     adc_ctx.last_log_ms = now;
     
     Serial.print(F("[ADC] Raw: "));
     Serial.print(raw_value);
     Serial.print(F(", Voltage: "));
     Serial.print(voltage, 3);  // 소수점 3자리
-    Serial.print(F("V, Samples: "));
+    Serial.print(F("V, Filtered: "));
+    Serial.print(adc_ctx.current_data.filtered);
+    Serial.print(F(", Samples: "));
     Serial.println(adc_ctx.sample_count);
   }
 }
@@ -86,7 +121,7 @@ const adc_data_t* adc_get_data(void)
 void adc_set_reference_voltage(float ref_voltage)
 {
   if (ref_voltage > 0.0f && ref_voltage <= 5.5f) {
-    adc_ctx.ref_voltage = ref_voltage;
+    adc_ctx.ref_mv = (uint16_t)(ref_voltage * 1000.0f + 0.5f);
     
     Serial.print(F("[ADC] Reference voltage set to "));
     Serial.print(ref_voltage);
@@ -116,7 +151,7 @@ void adc_print_stats(void)
   Serial.print(F("Pin: A"));
   Serial.println(adc_ctx.adc_pin - A0);
   Serial.print(F("Reference Voltage: "));
-  Serial.print(adc_ctx.ref_voltage);
+  Serial.print(adc_ctx.ref_mv / 1000.0f);
   Serial.println(F("V"));
   Serial.print(F("Total Samples: "));
   Serial.println(adc_ctx.sample_count);
@@ -130,6 +165,17 @@ void adc_print_stats(void)
     Serial.print(F("Last Update: "));
     Serial.print(adc_ctx.current_data.timestamp_ms);
     Serial.println(F(" ms"));
+    Serial.print(F("Filtered: "));
+    Serial.print(adc_ctx.current_data.filtered);
+    Serial.print(F(" (roc "));
+    Serial.print(adc_ctx.current_data.roc_per_s);
+    Serial.println(F("/s)"));
+    Serial.print(F("Window min/max/rms: "));
+    Serial.print(adc_ctx.current_data.win_min);
+    Serial.print(F("/"));
+    Serial.print(adc_ctx.current_data.win_max);
+    Serial.print(F("/"));
+    Serial.println(adc_ctx.current_data.win_rms);
   } else {
     Serial.println(F("No valid data"));
   }
@@ -10,6 +10,11 @@ typedef struct {
   float voltage;            // 전압 값 (V)
   uint32_t timestamp_ms;    // 측정 시간 (ms)
   uint8_t valid;            // 데이터 유효성
+  uint16_t filtered;        // 메디안-5(스파이크 제거) → EMA(1/8) 적용 값 (0-1023)
+  int32_t roc_per_s;        // filtered 변화율 (카운트/초)
+  uint16_t win_min;         // 최근 ADC_DSP_WINDOW 원시 샘플 최소
+  uint16_t win_max;         // 〃 최대
+  uint16_t win_rms;         // 〃 RMS
 } adc_data_t;
 
 /**
@@ -22,6 +27,7 @@ int adc_driver_init(void);
  * @brief ADC 드라이버 주기 태스크 (50ms 마다 호출됨)
  * 
  * ADC 값을 읽고 전압으로 변환하여 저장합니다.
+ * 후처리(adc_dsp.h, 고정소수점): 메디안-5 → EMA, 원시 샘플 창 min/max/RMS, 변화율
  */
 void adc_driver_task(void);
 
@@ -33,7 +39,7 @@ const adc_data_t* adc_get_data(void);
 
 /**
  * @brief ADC 참조 전압 설정
- * @param ref_voltage 참조 전압 (V) - 기본값 5.0V
+ * @param ref_voltage 참조 전압 (V) - 기본값 5.0V (내부는 mV 정수로 보관)
  */
 void adc_set_reference_voltage(float ref_voltage);
 
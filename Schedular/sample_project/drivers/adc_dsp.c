@@ -0,0 +1,228 @@
+/* adc_dsp.c */
+#include "adc_dsp.h"
+#include <stddef.h>
+
+#if defined(__GNUC__)
+#define DSP_RESTRICT __restrict__
+#else
+#define DSP_RESTRICT
+#endif
+
+/* ===== 링 버퍼 ===== */
+
+int dsp_ring_init(dsp_ring_t* r, int16_t* storage, uint8_t len)
+{
+  if (!storage || len < 2 || len > 128 || (len & (len - 1))) return -2;
+  r->buf = storage;
+  r->mask = (uint8_t)(len - 1);
+  r->head = 0;
+  r->count = 0;
+  return 0;
+}
+
+uint8_t dsp_ring_span(const dsp_ring_t* r, uint8_t n,
+                      int16_t** a, uint8_t* na, int16_t** b, uint8_t* nb)
+{
+  if (n > r->count) n = r->count;
+  uint8_t len = (uint8_t)(r->mask + 1);
+  uint8_t start = (uint8_t)((r->head - n) & r->mask);
+  uint8_t first = (uint8_t)(len - start);   // start 부터 배열 끝까지
+
+  *a = &r->buf[start];
+  if (n <= first) {
+    *na = n;
+    *b = NULL;
+    *nb = 0;
+  } else {
+    *na = first;
+    *b = r->buf;
+    *nb = (uint8_t)(n - first);
+  }
+  return n;
+}
+
+/* ===== 메디안 ===== */
+
+int dsp_median_init(dsp_median_t* m, uint8_t n)
+{
+  if (n < 3 || n > DSP_MEDIAN_MAX || !(n & 1)) return -2;
+  m->n = n;
+  m->pos = 0;
+  m->fill = 0;
+  return 0;
+}
+
+int16_t dsp_median_push(dsp_median_t* m, int16_t x)
+{
+  uint8_t k = m->fill;
+
+  if (k == m->n) {
+    // 가장 오래된 값을 정렬 사본에서 제거 (뒤쪽을 당김)
+    int16_t old = m->win[m->pos];
+    uint8_t i = 0;
+    while (m->sorted[i] != old) i++;
+    for (; i + 1 < k; ++i) m->sorted[i] = m->sorted[i + 1];
+    k--;
+  } else {
+    m->fill++;
+  }
+  m->win[m->pos] = x;
+  if (++m->pos >= m->n) m->pos = 0;
+
+  // 삽입 정렬 1단계
+  uint8_t j = k;
+  while (j > 0 && m->sorted[j - 1] > x) {
+    m->sorted[j] = m->sorted[j - 1];
+    j--;
+  }
+  m->sorted[j] = x;
+
+  return m->sorted[m->fill >> 1];
+}
+
+void dsp_median_block(dsp_median_t* m, int16_t* x, uint16_t n)
+{
+  for (uint16_t i = 0; i < n; ++i) x[i] = dsp_median_push(m, x[i]);
+}
+
+/* ===== EMA ===== */
+
+void dsp_ema_init(dsp_ema_t* e, uint8_t shift)
+{
+  if (shift < 1) shift = 1;
+  if (shift > 8) shift = 8;
+  e->acc = 0;
+  e->shift = shift;
+  e->primed = false;
+}
+
+int16_t dsp_ema_push(dsp_ema_t* e, int16_t x)
+{
+  int32_t xq = (int32_t)x << 8;
+  if (!e->primed) {
+    e->acc = xq;
+    e->primed = true;
+  } else {
+    e->acc += (xq - e->acc) >> e->shift;
+  }
+  return (int16_t)((e->acc + 128) >> 8);   // 반올림
+}
+
+void dsp_ema_block(dsp_ema_t* e, int16_t* x, uint16_t n)
+{
+  for (uint16_t i = 0; i < n; ++i) x[i] = dsp_ema_push(e, x[i]);
+}
+
+/* ===== 창 통계 =====
+ * 루프 본문에 분기/조기 종료가 없고 누산 변수가 지역 변수라 호스트 컴파일러가
+ * min/max/합/제곱합 리덕션을 SIMD 레인으로 나눈다 (gcc -O3 -fopt-info-vec 로 확인).
+ */
+
+void dsp_acc_reset(dsp_acc_t* a)
+{
+  a->min = INT16_MAX;
+  a->max = INT16_MIN;
+  a->sum = 0;
+  a->sumsq = 0;
+  a->n = 0;
+}
+
+void dsp_acc_block(dsp_acc_t* a, const int16_t* DSP_RESTRICT x, uint16_t n)
+{
+  int16_t mn = a->min;
+  int16_t mx = a->max;
+  int32_t sum = 0;
+  uint64_t sq = 0;   // 샘플 제곱은 32비트, 합은 64비트 (호스트: 64비트 레인으로 벡터화)
+
+  for (uint16_t i = 0; i < n; ++i) {
+    int16_t v = x[i];
+    mn = (v < mn) ? v : mn;
+    mx = (v > mx) ? v : mx;
+    sum += v;
+    sq += (uint32_t)((int32_t)v * v);
+  }
+
+  a->min = mn;
+  a->max = mx;
+  a->sum += sum;
+  a->sumsq += sq;
+  a->n = (uint16_t)(a->n + n);
+}
+
+int dsp_acc_result(const dsp_acc_t* a, dsp_stats_t* out)
+{
+  if (!a->n) return -1;
+  out->min = a->min;
+  out->max = a->max;
+  out->mean = (int16_t)(a->sum / (int32_t)a->n);
+  out->rms = dsp_isqrt32((uint32_t)(a->sumsq / a->n));   // 제곱 평균 <= 2^30 → 32비트 제곱근으로 충분
+  out->n = a->n;
+  return 0;
+}
+
+int dsp_ring_stats(const dsp_ring_t* r, uint8_t n, dsp_stats_t* out)
+{
+  int16_t *pa, *pb;
+  uint8_t na, nb;
+  dsp_acc_t acc;
+
+  dsp_ring_span(r, n, &pa, &na, &pb, &nb);
+  dsp_acc_reset(&acc);
+  dsp_acc_block(&acc, pa, na);
+  if (nb) dsp_acc_block(&acc, pb, nb);
+  return dsp_acc_result(&acc, out);
+}
+
+/* ===== 변화율 ===== */
+
+void dsp_roc_init(dsp_roc_t* d)
+{
+  d->prev = 0;
+  d->prev_ms = 0;
+  d->primed = false;
+}
+
+int32_t dsp_roc_push(dsp_roc_t* d, int16_t x, uint32_t ts_ms)
+{
+  int32_t roc = 0;
+  uint32_t dt = ts_ms - d->prev_ms;
+  if (d->primed && dt) roc = (int32_t)(x - d->prev) * 1000L / (int32_t)dt;
+  d->prev = x;
+  d->prev_ms = ts_ms;
+  d->primed = true;
+  return roc;
+}
+
+void dsp_diff_block(int16_t* x, uint16_t n, int16_t* prev)
+{
+  if (!n) return;
+  int16_t last = x[n - 1];
+  // 뒤에서부터 → 읽는 x[i-1] 은 아직 원본 (제자리, 벡터화 가능)
+  for (uint16_t i = (uint16_t)(n - 1); i > 0; --i) x[i] = (int16_t)(x[i] - x[i - 1]);
+  x[0] = (int16_t)(x[0] - *prev);
+  *prev = last;
+}
+
+/* ===== 변환 ===== */
+
+void dsp_scale_mv_block(int16_t* DSP_RESTRICT x, uint16_t n, uint16_t ref_mv, uint8_t bits)
+{
+  for (uint16_t i = 0; i < n; ++i) x[i] = (int16_t)(((int32_t)x[i] * ref_mv) >> bits);
+}
+
+uint16_t dsp_isqrt32(uint32_t v)
+{
+  uint32_t res = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint16_t)res;
+}
@@ -0,0 +1,163 @@
+/* adc_dsp.h */
+#ifndef ADC_DSP_H
+#define ADC_DSP_H
+
+/*
+ * ADC 후처리용 스트리밍 고정소수점 커널 (Arduino/호스트 공용, 하드웨어 의존 없음)
+ *
+ * - 모든 상태는 호출자 소유 구조체/배열 → 힙 없음
+ * - 블록 함수는 int16_t 배열을 제자리(in-place)에서 변환한다.
+ *   링 버퍼는 dsp_ring_span() 으로 최대 2개의 연속 구간을 얻어 그대로 넘긴다.
+ * - 샘플 범위: int16_t 전체. 누산기 제곱합은 uint64_t (풀스케일 2^30 × 65535 < 2^46),
+ *   한 누산기에 더하는 샘플 수 합계 <= 65535 (n 이 uint16_t)
+ * - 호스트 빌드(!__AVR__)의 누산/차분 블록은 분기 없는 루프로 작성되어 -O2 -ftree-vectorize
+ *   (또는 -O3) 에서 SIMD 로 자동 벡터화된다. AVR 은 16비트 연산 위주의 단순 루프.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DSP_MEDIAN_MAX  9      // 메디안 창 최대 길이 (홀수)
+
+/* ===== 링 버퍼 (저장소는 호출자 배열, 길이 2^k) ===== */
+typedef struct {
+  int16_t* buf;
+  uint8_t  mask;    // 길이 - 1
+  uint8_t  head;    // 다음 쓰기 위치
+  uint8_t  count;   // 저장된 샘플 수 (<= 길이)
+} dsp_ring_t;
+
+/**
+ * @brief 링 초기화
+ * @param len 배열 길이 (2 ~ 128, 2의 거듭제곱)
+ * @return 0: 성공, -2: 잘못된 길이
+ */
+int dsp_ring_init(dsp_ring_t* r, int16_t* storage, uint8_t len);
+
+static inline void dsp_ring_push(dsp_ring_t* r, int16_t x)
+{
+  r->buf[r->head] = x;
+  r->head = (uint8_t)((r->head + 1) & r->mask);
+  if (r->count <= r->mask) r->count++;
+}
+
+/**
+ * @brief 최근 n 샘플을 오래된 순의 연속 구간 최대 2개로 반환
+ * @return 실제 구간 샘플 수 합 (저장된 수가 적으면 그만큼)
+ */
+uint8_t dsp_ring_span(const dsp_ring_t* r, uint8_t n,
+                      int16_t** a, uint8_t* na, int16_t** b, uint8_t* nb);
+
+/* ===== 메디안-of-N (스파이크 제거) ===== */
+typedef struct {
+  int16_t  win[DSP_MEDIAN_MAX];     // 도착 순서 (링)
+  int16_t  sorted[DSP_MEDIAN_MAX];  // 정렬 사본
+  uint8_t  n;                       // 창 길이 (홀수)
+  uint8_t  pos;                     // 다음 교체 위치
+  uint8_t  fill;                    // 채워진 수
+} dsp_median_t;
+
+/**
+ * @brief 메디안 필터 초기화
+ * @param n 창 길이 (3, 5, 7, 9)
+ * @return 0: 성공, -2: 잘못된 길이
+ */
+int dsp_median_init(dsp_median_t* m, uint8_t n);
+
+/**
+ * @brief 샘플 1개 → 현재 창의 중앙값 (창이 덜 찼으면 채워진 부분의 중앙값)
+ * @note  정렬 사본에서 가장 오래된 값을 빼고 새 값을 삽입 — O(N), 나눗셈 없음
+ */
+int16_t dsp_median_push(dsp_median_t* m, int16_t x);
+
+void dsp_median_block(dsp_median_t* m, int16_t* x, uint16_t n);
+
+/* ===== 지수 이동 평균: y += (x - y) / 2^shift =====
+ * 상태는 Q8 (8비트 소수) 로 보관해 작은 변화도 잃지 않는다.
+ */
+typedef struct {
+  int32_t acc;      // y << 8
+  uint8_t shift;    // 1 ~ 8 (알파 = 1/2^shift)
+  bool    primed;   // 첫 샘플로 초기화됨
+} dsp_ema_t;
+
+void dsp_ema_init(dsp_ema_t* e, uint8_t shift);
+int16_t dsp_ema_push(dsp_ema_t* e, int16_t x);
+void dsp_ema_block(dsp_ema_t* e, int16_t* x, uint16_t n);
+
+/* ===== 창 통계 (min/max/평균/RMS) =====
+ * 누산기에 블록을 여러 번 더한 뒤(링의 두 구간 등) 결과를 낸다.
+ */
+typedef struct {
+  int16_t  min;
+  int16_t  max;
+  int32_t  sum;      // |x| <= 32768 × 65535 < 2^31
+  uint64_t sumsq;    // 풀스케일 제곱 2^30 — uint32_t 면 4샘플에서 넘침
+  uint16_t n;
+} dsp_acc_t;
+
+typedef struct {
+  int16_t  min;
+  int16_t  max;
+  int16_t  mean;
+  uint16_t rms;
+  uint16_t n;
+} dsp_stats_t;
+
+void dsp_acc_reset(dsp_acc_t* a);
+void dsp_acc_block(dsp_acc_t* a, const int16_t* x, uint16_t n);
+
+/**
+ * @brief 누산 결과
+ * @return 0: 성공, -1: 샘플 없음
+ */
+int dsp_acc_result(const dsp_acc_t* a, dsp_stats_t* out);
+
+/**
+ * @brief 링의 최근 n 샘플 통계 (구간 분할 포함)
+ */
+int dsp_ring_stats(const dsp_ring_t* r, uint8_t n, dsp_stats_t* out);
+
+/* ===== 변화율 ===== */
+typedef struct {
+  int16_t  prev;
+  uint32_t prev_ms;
+  bool     primed;
+} dsp_roc_t;
+
+void dsp_roc_init(dsp_roc_t* d);
+
+/**
+ * @brief 변화율 (카운트/초) — 샘플 시각 차이로 나눔 (지터 보정)
+ * @return 첫 샘플/동일 시각이면 0
+ */
+int32_t dsp_roc_push(dsp_roc_t* d, int16_t x, uint32_t ts_ms);
+
+/**
+ * @brief 고정 주기 블록 1차 차분 (제자리): x[i] = x[i] - x[i-1]
+ * @param prev 직전 블록 마지막 원본 샘플 (입출력)
+ */
+void dsp_diff_block(int16_t* x, uint16_t n, int16_t* prev);
+
+/* ===== 변환 ===== */
+
+/**
+ * @brief raw → mV (제자리): x = x * ref_mv >> bits
+ * @param bits ADC 분해능 (10 = 0~1023)
+ */
+void dsp_scale_mv_block(int16_t* x, uint16_t n, uint16_t ref_mv, uint8_t bits);
+
+/**
+ * @brief 정수 제곱근 (내림)
+ */
+uint16_t dsp_isqrt32(uint32_t v);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADC_DSP_H
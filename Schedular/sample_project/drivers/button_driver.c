@@ -1,23 +1,26 @@
 /* button_driver.c */
 #include "button_driver.h"
 #include <Arduino.h>
+#include "sched_input.h"
 
 // 버튼 핀 설정 (기본적으로 디지털 핀 2 사용)
 #ifndef BUTTON_PIN
 #define BUTTON_PIN 2
 #endif
 
-// 디바운스 카운트 (연속으로 같은 값이 나와야 하는 횟수)
+// 디바운스 카운트 (연속으로 같은 값이 나와야 하는 횟수, 2비트 카운터 → 최대 3)
 #define DEBOUNCE_COUNT 3
+#if DEBOUNCE_COUNT > 3
+#error "DEBOUNCE_COUNT must fit btn_ctx.debounce_count (2 bits)"
+#endif
 
-// 버튼 드라이버 내부 상태
+// 버튼 드라이버 내부 상태 (핀 레벨/카운터는 1바이트로 묶음)
 static struct {
-  uint8_t raw_state;          // 현재 읽은 원시 상태
-  uint8_t stable_state;       // 디바운스된 안정화 상태
-  uint8_t prev_stable_state;  // 이전 안정화 상태 (에지 검출용)
-  uint8_t debounce_count;     // 디바운스 카운터
-  uint32_t press_count;       // 누름 횟수 (누적)
-  button_callback_t callback; // 이벤트 콜백 함수
+  uint32_t press_count;           // 누름 횟수 (누적)
+  uint8_t raw_state      : 1;     // 현재 읽은 원시 상태
+  uint8_t stable_state   : 1;     // 디바운스된 안정화 상태
+  uint8_t debounce_count : 2;     // 디바운스 카운터
+  button_callback_t callback;     // 이벤트 콜백 함수
 } btn_ctx;
 
 int button_driver_init(void)
@@ -28,7 +31,6 @@ int button_driver_init(void)
   // 드라이버 상태 초기화
   btn_ctx.raw_state = HIGH;           // 풀업이므로 기본값은 HIGH
   btn_ctx.stable_state = HIGH;
-  btn_ctx.prev_stable_state = HIGH;
   btn_ctx.debounce_count = 0;
   btn_ctx.press_count = 0;
   btn_ctx.callback = NULL;
@@ -42,7 +44,8 @@ void button_driver_task(void)
 {
   // 10ms마다 호출되어 디바운스 처리 수행
   
-  uint8_t current_raw = digitalRead(BUTTON_PIN);
+  // 틱 ISR 이 래치한 입력 스냅샷 (다른 드라이버와 같은 시점)
+  uint8_t current_raw = sc_in_read_pin(BUTTON_PIN) ? HIGH : LOW;
   
   if (current_raw == btn_ctx.raw_state) {
     // 연속으로 같은 값이 나오고 있음
@@ -51,11 +54,11 @@ void button_driver_task(void)
       
       if (btn_ctx.debounce_count == DEBOUNCE_COUNT) {
         // 디바운스 완료 - 안정화된 상태로 인정
-        btn_ctx.prev_stable_state = btn_ctx.stable_state;
+        uint8_t prev_stable_state = btn_ctx.stable_state;
         btn_ctx.stable_state = current_raw;
         
         // 상태 변화 감지 (에지 검출)
-        if (btn_ctx.prev_stable_state != btn_ctx.stable_state) {
+        if (prev_stable_state != btn_ctx.stable_state) {
           if (btn_ctx.stable_state == LOW) {
             // 버튼 눌림 (HIGH -> LOW, 풀업이므로)
             btn_ctx.press_count++;
@@ -2,118 +2,355 @@
 #include "driver_manager.h"
 #include <string.h>
 #include <Arduino.h>
+#include "sched_core.h"
+#include "sched_output.h"
+#if DRIVER_SUPERVISOR
+#include "supervisor.h"
+#endif
+#if DRIVER_TRACE
+#include "trace.h"
+#endif
 
-// 최대 드라이버 수
-#ifndef MAX_DRIVERS
-#define MAX_DRIVERS 16
+#if SC_LOAD_DECIM > 8
+#error "driver_descriptor_t.shed_cnt is 3 bits (SC_LOAD_DECIM <= 8)"
 #endif
 
-// 전역 드라이버 테이블
+// 플래시 설정 읽기 (AVR: LPM, 그 외: 주소 공간이 같아 일반 함수)
+#ifdef __AVR__
+#define cfg_memcpy_P  memcpy_P
+#define cfg_strcmp_P  strcmp_P
+#define cfg_strlen_P  strlen_P
+#define cfg_strncpy_P strncpy_P
+#else
+#define cfg_memcpy_P  memcpy
+#define cfg_strcmp_P  strcmp
+#define cfg_strlen_P  strlen
+#define cfg_strncpy_P strncpy
+#endif
+
+// 전역 드라이버 테이블 (RAM 상태만, 설정은 cfg 포인터)
 static driver_descriptor_t g_drivers[MAX_DRIVERS];
 static int g_driver_count = 0;
 
+#if DRIVER_RAM_CONFIGS
+// driver_register() 설정 풀 (name == NULL 이면 빈 칸)
+static driver_config_t s_ram_cfg[DRIVER_RAM_CONFIGS];
+#endif
+
+// 드라이버 태스크 슬롯 (sched_core) — 훅 태그 = 드라이버 인덱스
+static sc_task_t  s_tasks[MAX_DRIVERS];
+static sc_sched_t s_sched;
+static sc_load_t  s_load;    // 과부하 감지기 (슬롯/사이클릭 공용)
+
+// 계측 카운터 (스택 사용량은 코어 슬롯, 과부하 계측은 감지기가 보관)
+static struct {
+  uint8_t  hwm;
+  uint16_t register_fail;
+  uint16_t slot_full;
+  uint16_t frame_lost;
+} s_stats;
+
 // 외부 스케줄러 변수 (ultra_light_sched에서 제공)
-extern volatile uint8_t g_flag_10ms;
-extern volatile uint8_t g_flag_50ms;
+extern volatile uint32_t g_tick_ms;
+
+// ===== 사이클릭 이그제큐티브 테이블 =====
+// 메이저 프레임 50ms = 마이너 프레임 10ms × 5
+#define CYCLIC_MINOR_MS    10
+#define CYCLIC_FRAME_COUNT 5
+
+// 목록은 드라이버 인덱스 — 중요도/솎음 카운터는 디스크립터에서 읽음
+static uint8_t s_cyc_10ms[MAX_DRIVERS];                    // 매 프레임 실행
+static uint8_t s_cyc_10ms_count = 0;
+static uint8_t s_cyc_50ms[MAX_DRIVERS];                    // 프레임 순 정렬
+static uint8_t s_cyc_frame_start[CYCLIC_FRAME_COUNT + 1];  // 프레임별 시작 인덱스
+static uint8_t s_cyc_frame = 0;                            // 현재 마이너 프레임
+static uint8_t s_cyc_dirty = 1;                            // 드라이버 구성 변경됨
+static uint32_t s_cyc_due = 0;                             // 다음 마이너 프레임 시각
 
 // ===== 내부 함수 =====
 
-static driver_descriptor_t* find_driver(const char* name)
+// 설정 사본 (ram = 0 이면 cfg 는 플래시 주소)
+static void cfg_read(const driver_config_t* cfg, uint8_t ram, driver_config_t* out)
+{
+  if (ram) *out = *cfg;
+  else cfg_memcpy_P(out, cfg, sizeof(*out));
+}
+
+static void cfg_get(const driver_descriptor_t* drv, driver_config_t* out)
+{
+  cfg_read(drv->cfg, drv->cfg_ram, out);
+}
+
+// 사이클릭 경로용 — 설정 전체를 복사하지 않고 함수 포인터만 읽음
+static driver_task_fn_t cfg_task_fn(const driver_descriptor_t* drv)
+{
+#ifdef __AVR__
+  if (!drv->cfg_ram) return (driver_task_fn_t)pgm_read_ptr(&drv->cfg->task_fn);
+#endif
+  return drv->cfg->task_fn;
+}
+
+static void print_name(const driver_config_t* c, uint8_t ram)
 {
+  if (ram) Serial.print(c->name);
+  else Serial.print((const __FlashStringHelper*)c->name);
+}
+
+static int find_index(const char* name)
+{
+  driver_config_t c;
   for (int i = 0; i < g_driver_count; i++) {
-    if (strcmp(g_drivers[i].name, name) == 0) {
-      return &g_drivers[i];
-    }
+    cfg_get(&g_drivers[i], &c);
+    int diff = g_drivers[i].cfg_ram ? strcmp(name, c.name) : cfg_strcmp_P(name, c.name);
+    if (diff == 0) return i;
   }
-  return NULL;
+  return -1;
 }
 
-// ===== 공개 API 구현 =====
+static driver_descriptor_t* find_driver(const char* name)
+{
+  int i = find_index(name);
+  return (i < 0) ? NULL : &g_drivers[i];
+}
 
-int driver_register(const char* name,
-                   driver_init_fn_t init_fn,
-                   driver_task_fn_t task_fn,
-                   uint8_t period_ms)
+static void set_enable(driver_descriptor_t* drv, bool enable)
 {
+  drv->enabled = enable ? 1 : 0;
+  sc_enable(&s_sched, drv->task_id, enable, g_tick_ms);
+  s_cyc_dirty = 1;
+#if DRIVER_TRACE
+  trace_event(enable ? TRACE_EV_DRV_ENABLE : TRACE_EV_DRV_DISABLE, (uint8_t)(drv - g_drivers));
+#endif
+  
+  driver_config_t c;
+  cfg_get(drv, &c);
+  Serial.print(F("[DRV] '"));
+  print_name(&c, drv->cfg_ram);
+  Serial.print(F("' "));
+  Serial.println(enable ? F("ENABLED") : F("DISABLED"));
+}
+
+#if DRIVER_SUPERVISOR
+// 예산 초과 조치: 해당 슬롯 드라이버 비활성화
+static void on_driver_overrun(uint8_t id)
+{
+  if (id < g_driver_count) set_enable(&g_drivers[id], false);
+}
+#endif
+
+#if DRIVER_SUPERVISOR || DRIVER_TRACE
+// 드라이버 1회 실행 전후 훅 (예산 감시 + 트레이스), id = 드라이버 인덱스
+static void driver_begin(uint8_t id)
+{
+#if DRIVER_TRACE
+  trace_event(TRACE_EV_TASK_BEGIN, (uint8_t)(TRACE_ID_DRIVER + id));
+#endif
+#if DRIVER_SUPERVISOR
+  sup_task_begin(id);
+#endif
+}
+
+static void driver_end(uint8_t id)
+{
+#if DRIVER_SUPERVISOR
+  sup_task_end(id);
+#endif
+#if DRIVER_TRACE
+  trace_event(TRACE_EV_TASK_END, (uint8_t)(TRACE_ID_DRIVER + id));
+#endif
+}
+#endif
+
+// 첫 등록 시 코어 인스턴스 준비
+static void sched_ready(void)
+{
+  if (s_sched.slots) return;
+  sc_init(&s_sched, s_tasks, MAX_DRIVERS);
+  sc_load_init(&s_load, DRIVER_LOAD_LATE_MS, DRIVER_LOAD_ENTER, DRIVER_LOAD_EXIT);
+  sc_set_load(&s_sched, &s_load);
+#if DRIVER_SUPERVISOR || DRIVER_TRACE
+  sc_set_hooks(&s_sched, driver_begin, driver_end);
+#endif
+}
+
+// 공통 등록 경로 — 설정은 포인터만 보관 (ram = 0: 플래시)
+static int register_cfg(const driver_config_t* cfg, uint8_t ram)
+{
+  driver_config_t c;
+  cfg_read(cfg, ram, &c);
+
   // 파라미터 검증
-  if (!name) {
+  if (!c.name) {
     Serial.println(F("[DRV] ERROR: name is NULL"));
+    s_stats.register_fail++;
+    return -2;
+  }
+
+  if ((ram ? strlen(c.name) : cfg_strlen_P(c.name)) > DRIVER_NAME_MAX) {
+    Serial.println(F("[DRV] ERROR: name too long"));
+    s_stats.register_fail++;
     return -2;
   }
   
-  if (period_ms != 10 && period_ms != 50) {
+  if (c.period_ms != 10 && c.period_ms != 50) {
     Serial.print(F("[DRV] ERROR: Invalid period "));
-    Serial.println(period_ms);
+    Serial.println(c.period_ms);
+    s_stats.register_fail++;
+    return -2;
+  }
+
+  if (c.criticality > SC_CRIT_HIGH) {
+    Serial.println(F("[DRV] ERROR: Invalid criticality"));
+    s_stats.register_fail++;
     return -2;
   }
   
   // 슬롯 확인
   if (g_driver_count >= MAX_DRIVERS) {
     Serial.println(F("[DRV] ERROR: Driver slots full"));
+    s_stats.register_fail++;
+    s_stats.slot_full++;
     return -1;
   }
   
-  // 중복 확인
+  // 중복 확인 (RAM 이름 사본으로 비교)
+  char name[DRIVER_NAME_MAX + 1];
+  if (ram) strcpy(name, c.name);
+  else cfg_strncpy_P(name, c.name, sizeof(name));
   if (find_driver(name)) {
     Serial.print(F("[DRV] WARNING: Driver '"));
     Serial.print(name);
     Serial.println(F("' already registered"));
+    s_stats.register_fail++;
     return -2;
   }
   
   // 드라이버 등록
   driver_descriptor_t* drv = &g_drivers[g_driver_count];
-  drv->name = name;
-  drv->init_fn = init_fn;
-  drv->task_fn = task_fn;
-  drv->period_ms = period_ms;
+  drv->cfg = cfg;
+  drv->cfg_ram = ram;
   drv->enabled = 0;        // 기본 비활성
   drv->initialized = 0;
+  drv->task_id = -1;
+  drv->criticality = c.criticality;
+  drv->shed_cnt = 0;
   
   Serial.print(F("[DRV] Registering '"));
   Serial.print(name);
   Serial.print(F("' @ "));
-  Serial.print(period_ms);
+  Serial.print(c.period_ms);
   Serial.print(F("ms"));
   
   // 초기화 함수 실행
-  if (init_fn) {
-    int ret = init_fn();
+  if (c.init_fn) {
+    int ret = c.init_fn();
     if (ret != 0) {
       Serial.print(F(" - Init FAILED ("));
       Serial.print(ret);
       Serial.println(F(")"));
+      s_stats.register_fail++;
       return -3;
     }
     drv->initialized = 1;
   }
   
+  // 주기 태스크 슬롯 — 첫 릴리즈는 주기 격자(10ms/50ms 배수)에 맞춤
+  if (c.task_fn) {
+    sched_ready();
+    drv->task_id = (int8_t)sc_add0_at(&s_sched, c.task_fn, sc_next_grid(g_tick_ms + 1, c.period_ms), c.period_ms);
+    sc_set_tag(&s_sched, drv->task_id, (uint8_t)g_driver_count);
+    sc_set_crit(&s_sched, drv->task_id, c.criticality);
+  }
+
   // 등록 완료 후 자동 활성화
   drv->enabled = 1;
   g_driver_count++;
+  if (g_driver_count > s_stats.hwm) s_stats.hwm = (uint8_t)g_driver_count;
+  s_cyc_dirty = 1;
   
   Serial.println(F(" - OK"));
   return 0;
 }
 
-int driver_unregister(const char* name)
+// ===== 공개 API 구현 =====
+
+int driver_register_P(const driver_config_t* cfg)
 {
-  for (int i = 0; i < g_driver_count; i++) {
-    if (strcmp(g_drivers[i].name, name) == 0) {
-      // 배열에서 제거 (뒤에 있는 것들을 앞으로 이동)
-      for (int j = i; j < g_driver_count - 1; j++) {
-        g_drivers[j] = g_drivers[j + 1];
-      }
-      g_driver_count--;
-      
-      Serial.print(F("[DRV] Unregistered '"));
-      Serial.print(name);
-      Serial.println(F("'"));
-      return 0;
+  if (!cfg) {
+    Serial.println(F("[DRV] ERROR: config is NULL"));
+    s_stats.register_fail++;
+    return -2;
+  }
+  return register_cfg(cfg, 0);
+}
+
+int driver_register(const char* name,
+                   driver_init_fn_t init_fn,
+                   driver_task_fn_t task_fn,
+                   uint8_t period_ms)
+{
+#if DRIVER_RAM_CONFIGS
+  // RAM 설정 풀에서 빈 칸 확보 (실패하면 name = NULL 로 되돌림)
+  driver_config_t* c = NULL;
+  for (uint8_t i = 0; i < DRIVER_RAM_CONFIGS; i++) {
+    if (!s_ram_cfg[i].name) {
+      c = &s_ram_cfg[i];
+      break;
     }
   }
-  
+  if (!c) {
+    Serial.println(F("[DRV] ERROR: RAM config slots full (DRIVER_RAM_CONFIGS)"));
+    s_stats.register_fail++;
+    s_stats.slot_full++;
+    return -1;
+  }
+
+  c->name = name;
+  c->init_fn = init_fn;
+  c->task_fn = task_fn;
+  c->period_ms = period_ms;
+  c->criticality = SC_CRIT_NORMAL;
+
+  int ret = register_cfg(c, 1);
+  if (ret != 0) c->name = NULL;
+  return ret;
+#else
+  (void)name; (void)init_fn; (void)task_fn; (void)period_ms;
+  Serial.println(F("[DRV] ERROR: DRIVER_RAM_CONFIGS is 0 (use driver_register_P)"));
+  s_stats.register_fail++;
   return -1;
+#endif
+}
+
+int driver_unregister(const char* name)
+{
+  int i = find_index(name);
+  if (i < 0) return -1;
+
+  driver_descriptor_t* drv = &g_drivers[i];
+  sc_cancel(&s_sched, drv->task_id);
+#if DRIVER_RAM_CONFIGS
+  if (drv->cfg_ram) s_ram_cfg[drv->cfg - s_ram_cfg].name = NULL;   // 설정 풀 반환
+#endif
+
+  // 배열에서 제거 (뒤에 있는 것들을 앞으로 이동)
+  for (int j = i; j < g_driver_count - 1; j++) {
+    g_drivers[j] = g_drivers[j + 1];
+    sc_set_tag(&s_sched, g_drivers[j].task_id, (uint8_t)j);
+#if DRIVER_SUPERVISOR
+    sup_move(j + 1, j);   // 슬롯 인덱스 = supervisor ID
+#endif
+  }
+#if DRIVER_SUPERVISOR
+  sup_unregister(g_driver_count - 1);
+#endif
+  g_driver_count--;
+  s_cyc_dirty = 1;
+  
+  Serial.print(F("[DRV] Unregistered '"));
+  Serial.print(name);
+  Serial.println(F("'"));
+  return 0;
 }
 
 int driver_set_enable(const char* name, bool enable)
@@ -121,41 +358,142 @@ int driver_set_enable(const char* name, bool enable)
   driver_descriptor_t* drv = find_driver(name);
   if (!drv) return -1;
   
-  drv->enabled = enable ? 1 : 0;
-  
-  Serial.print(F("[DRV] '"));
-  Serial.print(name);
-  Serial.print(F("' "));
-  Serial.println(enable ? F("ENABLED") : F("DISABLED"));
-  
+  set_enable(drv, enable);
+  return 0;
+}
+
+int driver_set_criticality(const char* name, uint8_t crit)
+{
+  driver_descriptor_t* drv = find_driver(name);
+  if (!drv) return -1;
+  if (crit > SC_CRIT_HIGH) return -2;
+
+  drv->criticality = crit;
+  drv->shed_cnt = 0;
+  sc_set_crit(&s_sched, drv->task_id, crit);   // 태스크 없는 드라이버(-1)는 무시됨
   return 0;
 }
 
+#if DRIVER_SUPERVISOR
+int driver_set_budget(const char* name, uint8_t budget_ms, bool critical, bool disable_on_overrun)
+{
+  driver_descriptor_t* drv = find_driver(name);
+  if (!drv) return -1;
+
+  sup_register((uint8_t)(drv - g_drivers), budget_ms, critical,
+               disable_on_overrun ? on_driver_overrun : NULL);
+  return 0;
+}
+#endif
+
 void driver_manager_run(void)
 {
-  // 10ms 태스크 실행
-  if (g_flag_10ms) {
-    g_flag_10ms = 0;
-    
-    for (int i = 0; i < g_driver_count; i++) {
-      driver_descriptor_t* drv = &g_drivers[i];
-      if (drv->enabled && drv->task_fn && drv->period_ms == 10) {
-        drv->task_fn();
-      }
-    }
+  // 만기된 10ms/50ms 드라이버 실행 (슬롯 스캔/주기 관리는 코어)
+  sc_run(&s_sched, g_tick_ms);
+  sc_out_commit();   // 드라이버가 바꾼 출력 핀 일괄 반영
+}
+
+void driver_manager_build_schedule(void)
+{
+  uint8_t n50 = 0;
+  s_cyc_10ms_count = 0;
+
+  driver_config_t c;
+
+  // 10ms 드라이버: 모든 프레임 공통 목록
+  for (int i = 0; i < g_driver_count; i++) {
+    cfg_get(&g_drivers[i], &c);
+    if (!g_drivers[i].enabled || !c.task_fn) continue;
+    if (c.period_ms == 10) s_cyc_10ms[s_cyc_10ms_count++] = (uint8_t)i;
+    else n50++;
   }
-  
-  // 50ms 태스크 실행
-  if (g_flag_50ms) {
-    g_flag_50ms = 0;
-    
+
+  // 50ms 드라이버: k번째 → 프레임 (k % 5) 로 분산 배치 (부하 평준화)
+  uint8_t idx = 0;
+  for (uint8_t f = 0; f < CYCLIC_FRAME_COUNT; f++) {
+    s_cyc_frame_start[f] = idx;
+    uint8_t k = 0;
     for (int i = 0; i < g_driver_count; i++) {
-      driver_descriptor_t* drv = &g_drivers[i];
-      if (drv->enabled && drv->task_fn && drv->period_ms == 50) {
-        drv->task_fn();
-      }
+      cfg_get(&g_drivers[i], &c);
+      if (!g_drivers[i].enabled || !c.task_fn || c.period_ms != 50) continue;
+      if (k++ % CYCLIC_FRAME_COUNT == f) s_cyc_50ms[idx++] = (uint8_t)i;
     }
   }
+  s_cyc_frame_start[CYCLIC_FRAME_COUNT] = idx;
+  s_cyc_dirty = 0;
+
+  Serial.print(F("[DRV] Cyclic schedule: "));
+  Serial.print(s_cyc_10ms_count);
+  Serial.print(F(" x 10ms, "));
+  Serial.print(n50);
+  Serial.println(F(" x 50ms / 5 frames"));
+}
+
+// 사이클릭 프레임의 드라이버 1개 — 과부하 단계/중요도로 솎음 (차단 수는 감지기에 집계)
+static void cyclic_call(uint8_t idx)
+{
+  driver_descriptor_t* drv = &g_drivers[idx];
+  uint8_t cnt = drv->shed_cnt;
+  bool run = sc_load_admit(&s_load, drv->criticality, &cnt);
+  drv->shed_cnt = cnt;
+  if (run) cfg_task_fn(drv)();
+}
+
+void driver_manager_run_cyclic(void)
+{
+  if (s_cyc_dirty) driver_manager_build_schedule();
+  sched_ready();
+
+  uint32_t now = g_tick_ms;
+  if (!sc_after_eq(now, s_cyc_due)) return;
+  sc_load_report(&s_load, now - s_cyc_due);
+  s_cyc_due += CYCLIC_MINOR_MS;
+  if (sc_after_eq(now, s_cyc_due)) {            // 프레임 누락 → 집계 후 재정렬
+    s_stats.frame_lost += (uint16_t)((now - s_cyc_due) / CYCLIC_MINOR_MS + 1);
+    s_cyc_due = sc_next_grid(now + 1, CYCLIC_MINOR_MS);
+  }
+
+  for (uint8_t i = 0; i < s_cyc_10ms_count; i++) cyclic_call(s_cyc_10ms[i]);
+
+  uint8_t end = s_cyc_frame_start[s_cyc_frame + 1];
+  for (uint8_t i = s_cyc_frame_start[s_cyc_frame]; i < end; i++) cyclic_call(s_cyc_50ms[i]);
+  sc_out_commit();
+
+  if (++s_cyc_frame >= CYCLIC_FRAME_COUNT) s_cyc_frame = 0;
+}
+
+void driver_manager_get_stats(driver_manager_stats_t* out)
+{
+  if (!out) return;
+  for (int i = 0; i < MAX_DRIVERS; i++) {
+    const sc_task_t* t = (i < g_driver_count) ? sc_task(&s_sched, g_drivers[i].task_id) : NULL;
+    out->stack_max[i] = t ? t->stack_max : 0;
+  }
+  out->count = (uint8_t)g_driver_count;
+  out->hwm = s_stats.hwm;
+  out->cap = MAX_DRIVERS;
+  out->register_fail = s_stats.register_fail;
+  out->slot_full = s_stats.slot_full;
+  out->frame_lost = s_stats.frame_lost;
+  sc_load_get_stats(&s_load, &out->load);
+}
+
+int driver_manager_get(int idx, driver_info_t* out)
+{
+  if (idx < 0 || idx >= g_driver_count || !out) return -1;
+
+  const driver_descriptor_t* drv = &g_drivers[idx];
+  driver_config_t c;
+  cfg_get(drv, &c);
+  if (drv->cfg_ram) strncpy(out->name, c.name, sizeof(out->name));
+  else cfg_strncpy_P(out->name, c.name, sizeof(out->name));
+  out->name[DRIVER_NAME_MAX] = '\0';
+  out->period_ms = c.period_ms;
+  out->enabled = drv->enabled;
+  out->initialized = drv->initialized;
+  out->criticality = drv->criticality;
+  out->task_id = drv->task_id;
+  return 0;
 }
 
 void driver_manager_list(void)
@@ -168,13 +506,15 @@ void driver_manager_list(void)
   
   for (int i = 0; i < g_driver_count; i++) {
     driver_descriptor_t* drv = &g_drivers[i];
+    driver_config_t c;
+    cfg_get(drv, &c);
     
     Serial.print(F("["));
     Serial.print(i);
     Serial.print(F("] "));
-    Serial.print(drv->name);
+    print_name(&c, drv->cfg_ram);
     Serial.print(F(" - "));
-    Serial.print(drv->period_ms);
+    Serial.print(c.period_ms);
     Serial.print(F("ms - "));
     Serial.print(drv->enabled ? F("ENABLED") : F("DISABLED"));
     Serial.print(F(" - "));
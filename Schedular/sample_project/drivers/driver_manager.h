@@ -4,6 +4,43 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "sched_load.h"
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#endif
+#ifndef PROGMEM
+#define PROGMEM   // 플래시/RAM 주소 공간이 같은 보드
+#endif
+
+// 최대 드라이버 수
+#ifndef MAX_DRIVERS
+#define MAX_DRIVERS 16
+#endif
+
+// 드라이버 태스크는 공용 코어(sched_core)의 주기 슬롯으로 실행됨
+// (core/sched_core.c 를 스케치 폴더에 함께 복사, 스택 창 크기 = SC_STACK_PAINT_BYTES)
+
+// 과부하 감지: 마감 지연 ≥ LATE_MS 가 ENTER 패스 연속이면 단계 올림, EXIT 패스 연속 정상이면 내림
+// 단계에 따라 중요도 낮은 드라이버를 솎거나 건너뜀 (core/sched_load.c 를 스케치 폴더에 함께 복사)
+#ifndef DRIVER_LOAD_LATE_MS
+#define DRIVER_LOAD_LATE_MS 5
+#endif
+#ifndef DRIVER_LOAD_ENTER
+#define DRIVER_LOAD_ENTER   3
+#endif
+#ifndef DRIVER_LOAD_EXIT
+#define DRIVER_LOAD_EXIT    50
+#endif
+
+// 예산 감시/워치독 연동 (InputTestC/supervisor.c 를 스케치 폴더에 함께 복사)
+#ifndef DRIVER_SUPERVISOR
+#define DRIVER_SUPERVISOR 0
+#endif
+
+// 이벤트 트레이스 연동 (InputTestC/trace.c 를 스케치 폴더에 함께 복사)
+#ifndef DRIVER_TRACE
+#define DRIVER_TRACE 0
+#endif
 
 // 드라이버 초기화 함수 타입
 typedef int (*driver_init_fn_t)(void);
@@ -11,25 +48,94 @@ typedef int (*driver_init_fn_t)(void);
 // 드라이버 태스크 함수 타입
 typedef void (*driver_task_fn_t)(void);
 
-// 드라이버 디스크립터
+// 드라이버 이름 최대 길이 (널 제외)
+#define DRIVER_NAME_MAX 15
+
+// driver_register() (RAM 설정) 로 동시에 등록할 수 있는 드라이버 수
+// DRIVER_CONFIG() + driver_register_P() 만 쓰면 0 으로 두어 RAM 을 아낌
+#ifndef DRIVER_RAM_CONFIGS
+#define DRIVER_RAM_CONFIGS 4
+#endif
+
+// 드라이버 설정 (불변) — DRIVER_CONFIG() 로 선언하면 AVR 에서 플래시에 남음
 typedef struct {
-  const char*       name;         // 드라이버 이름 (디버깅용)
+  const char*       name;         // 드라이버 이름 (DRIVER_CONFIG: 플래시 문자열)
   driver_init_fn_t  init_fn;      // 초기화 함수 (NULL 가능)
   driver_task_fn_t  task_fn;      // 주기 태스크 함수 (NULL 가능)
   uint8_t           period_ms;    // 실행 주기 (10 or 50)
-  uint8_t           enabled;      // 활성화 상태
-  uint8_t           initialized;  // 초기화 완료 여부
+  uint8_t           criticality;  // 기본 중요도 SC_CRIT_LOW/NORMAL/HIGH
+} driver_config_t;
+
+// 드라이버 디스크립터 (RAM, 슬롯당 AVR 4바이트) — 설정은 cfg 가 가리킴
+typedef struct {
+  const driver_config_t* cfg;     // 설정 (cfg_ram 이 0 이면 플래시 주소)
+  int8_t   task_id;               // 코어 슬롯 (-1 = 태스크 없음)
+  uint8_t  enabled     : 1;       // 활성화 상태
+  uint8_t  initialized : 1;       // 초기화 완료 여부
+  uint8_t  cfg_ram     : 1;       // cfg 가 RAM (driver_register() 로 등록)
+  uint8_t  criticality : 2;       // 현재 중요도 (driver_set_criticality)
+  uint8_t  shed_cnt    : 3;       // 사이클릭 모드 솎음 카운터 (내부용, SC_LOAD_DECIM ≤ 8)
 } driver_descriptor_t;
 
+// 드라이버 조회 스냅샷 (driver_manager_get)
+typedef struct {
+  char     name[DRIVER_NAME_MAX + 1];
+  uint8_t  period_ms;
+  uint8_t  enabled;
+  uint8_t  initialized;
+  uint8_t  criticality;
+  int8_t   task_id;
+} driver_info_t;
+
 /**
- * @brief 드라이버 등록
+ * @brief 플래시 상주 드라이버 설정 선언
  * 
- * @param name        드라이버 이름 (최대 15자)
+ * 이름 문자열과 설정 구조체를 모두 PROGMEM 으로 둡니다 (AVR 외에는 일반 const).
+ * 
+ * @code
+ * DRIVER_CONFIG(cfg_led, "LED", led_driver_init, led_driver_task, 10, SC_CRIT_NORMAL);
+ * driver_register_P(&cfg_led);
+ * @endcode
+ */
+#define DRIVER_CONFIG(var, name_str, init_fn, task_fn, period_ms, crit) \
+  static const char var##_name[] PROGMEM = name_str; \
+  static const driver_config_t var PROGMEM = { var##_name, init_fn, task_fn, period_ms, crit }
+
+// 드라이버 매니저 계측 스냅샷
+typedef struct {
+  uint16_t stack_max[MAX_DRIVERS]; // 슬롯별 최대 스택 사용량 (bytes, 창 크기면 초과)
+  uint8_t  count;                  // 현재 등록 수
+  uint8_t  hwm;                    // 최대 동시 등록 수
+  uint8_t  cap;                    // MAX_DRIVERS
+  uint16_t register_fail;          // 등록 실패 횟수 (슬롯 부족 포함)
+  uint16_t slot_full;              // 그 중 슬롯 부족 횟수
+  uint16_t frame_lost;             // 사이클릭 모드: 루프가 밀려 건너뛴 마이너 프레임 수
+  sc_load_stats_t load;            // 과부하 단계/최대 지연/놓친·차단 릴리즈/진입·복귀 수
+} driver_manager_stats_t;
+
+/**
+ * @brief 드라이버 등록 (플래시 설정)
+ * 
+ * 설정은 복사하지 않고 포인터만 보관합니다 — RAM 은 디스크립터 4바이트뿐.
+ * 
+ * @param cfg   DRIVER_CONFIG() 로 선언한 설정
+ * 
+ * @return 0: 성공, -1: 슬롯 부족, -2: 잘못된 파라미터, -3: 초기화 실패
+ */
+int driver_register_P(const driver_config_t* cfg);
+
+/**
+ * @brief 드라이버 등록 (RAM 설정)
+ * 
+ * 설정을 DRIVER_RAM_CONFIGS 개짜리 RAM 풀에 복사합니다. 이름 문자열은 복사하지 않으므로
+ * 등록 해제 전까지 유효해야 합니다 (문자열 리터럴이면 충분).
+ * 
+ * @param name        드라이버 이름 (최대 DRIVER_NAME_MAX 자)
  * @param init_fn     초기화 함수 포인터 (NULL 가능)
  * @param task_fn     주기 태스크 함수 포인터 (NULL 가능)
  * @param period_ms   실행 주기 (10 또는 50)
  * 
- * @return 0: 성공, -1: 슬롯 부족, -2: 잘못된 파라미터, -3: 초기화 실패
+ * @return 0: 성공, -1: 슬롯/RAM 설정 부족, -2: 잘못된 파라미터, -3: 초기화 실패
  */
 int driver_register(const char* name, 
                    driver_init_fn_t init_fn,
@@ -53,13 +159,76 @@ int driver_unregister(const char* name);
  */
 int driver_set_enable(const char* name, bool enable);
 
+/**
+ * @brief 드라이버 중요도 설정 (과부하 차단 순서)
+ * 
+ * 과부하(OVER)에서는 LOW 드라이버를 4회 중 1회만 실행하고, 지연이 계속되면(SHED)
+ * LOW 는 건너뛰고 NORMAL 을 솎습니다. HIGH 는 항상 실행합니다.
+ * 
+ * @param name  드라이버 이름
+ * @param crit  SC_CRIT_LOW / SC_CRIT_NORMAL / SC_CRIT_HIGH
+ * @return 0: 성공, -1: 찾을 수 없음, -2: 잘못된 중요도
+ */
+int driver_set_criticality(const char* name, uint8_t crit);
+
+#if DRIVER_SUPERVISOR
+/**
+ * @brief 드라이버 실행 예산 설정 (supervisor 연동)
+ * 
+ * 슬롯 인덱스를 supervisor 태스크 ID로 사용합니다. 타이머 ISR에서
+ * sup_tick(g_tick_ms)를 호출해야 행(hang) 감지와 워치독이 동작합니다.
+ * 
+ * @param name                드라이버 이름
+ * @param budget_ms           실행 예산 (ms, 0 = 감시 안 함)
+ * @param critical            true: 워치독 윈도우마다 실행되어야 함
+ * @param disable_on_overrun  true: 예산 초과 시 driver_set_enable(name, false)
+ * @return 0: 성공, -1: 찾을 수 없음
+ */
+int driver_set_budget(const char* name, uint8_t budget_ms, bool critical, bool disable_on_overrun);
+#endif
+
 /**
  * @brief 드라이버 매니저 실행 (loop에서 호출)
  * 
- * 10ms/50ms 플래그를 체크하여 해당 주기의 드라이버를 실행합니다.
+ * 마감 시각이 된 10ms/50ms 드라이버를 실행합니다 (10ms/50ms 플래그 불필요).
+ * 드라이버 첫 실행은 등록 이후 첫 주기 격자(g_tick_ms 의 10/50 배수)입니다.
+ * 실행 후 sc_out_commit() 으로 드라이버가 바꾼 출력 섀도(sched_output)를 포트당 1회 씁니다.
+ * 드라이버 마감 지연은 과부하 감지기에 보고되고, 과부하 중에는 중요도 낮은 드라이버를 솎습니다.
  */
 void driver_manager_run(void);
 
+/**
+ * @brief 사이클릭 이그제큐티브 프레임 테이블 생성
+ * 
+ * 50ms 메이저 프레임을 10ms 마이너 프레임 5개로 나누고, 각 프레임에서
+ * 호출할 태스크 함수 목록을 미리 계산합니다. 50ms 드라이버는 프레임에
+ * 분산 배치됩니다. 등록/해제/활성화 변경 시 다음 실행에서 자동 재생성됩니다.
+ */
+void driver_manager_build_schedule(void);
+
+/**
+ * @brief 드라이버 매니저 실행 - 사이클릭 이그제큐티브 모드 (loop에서 호출)
+ * 
+ * driver_manager_run() 대체용. g_tick_ms 10ms 경계마다 현재 마이너 프레임의
+ * 함수 목록만 호출하므로 틱당 비용이 일정합니다 (드라이버별 플래그/주기 검사 없음).
+ * 루프가 밀려 건너뛴 프레임은 frame_lost 로 집계하고, 프레임 지연은 과부하 감지기에 보고합니다.
+ */
+void driver_manager_run_cyclic(void);
+
+/**
+ * @brief 드라이버 매니저 계측 값 조회
+ * @param out 결과 저장 위치 (NULL 이면 무시)
+ */
+void driver_manager_get_stats(driver_manager_stats_t* out);
+
+/**
+ * @brief 슬롯 인덱스로 드라이버 조회 (텔레메트리 등 목록 열거용)
+ * @param idx 0 ~ 등록 수-1
+ * @param out 설정 + 상태 사본 (이름은 RAM 으로 복사)
+ * @return 0: 성공, -1: 범위 밖
+ */
+int driver_manager_get(int idx, driver_info_t* out);
+
 /**
  * @brief 등록된 드라이버 목록 출력 (디버깅용)
  */
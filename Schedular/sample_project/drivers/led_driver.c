@@ -1,17 +1,18 @@
 /* led_driver.c */
 #include "led_driver.h"
 #include <Arduino.h>
+#include "sched_output.h"
 
 // 외부 스케줄러 변수
 extern volatile uint32_t g_tick_ms;
 
 // LED 드라이버 내부 상태
 static struct {
-  uint16_t blink_rate_ms;     // 깜빡임 주기
   uint32_t last_toggle_ms;    // 마지막 토글 시간
-  uint8_t state;              // 현재 LED 상태 (0/1)
-  uint8_t blink_enabled;      // 깜빡임 모드 활성화 여부
-  uint8_t manual_state;       // 수동 모드에서의 LED 상태
+  uint16_t blink_rate_ms;     // 깜빡임 주기
+  uint8_t state         : 1;  // 현재 LED 상태 (0/1)
+  uint8_t blink_enabled : 1;  // 깜빡임 모드 활성화 여부
+  uint8_t manual_state  : 1;  // 수동 모드에서의 LED 상태
 } led_ctx;
 
 int led_driver_init(void)
@@ -33,7 +34,7 @@ int led_driver_init(void)
 
 void led_driver_task(void)
 {
-  // 10ms마다 호출됨
+  // 10ms마다 호출됨 — 핀은 섀도에만 쓰고 드라이버 매니저가 실행 후 일괄 커밋
   
   if (led_ctx.blink_enabled) {
     // 깜빡임 모드
@@ -42,13 +43,13 @@ void led_driver_task(void)
     if (now - led_ctx.last_toggle_ms >= led_ctx.blink_rate_ms) {
       led_ctx.last_toggle_ms = now;
       led_ctx.state = !led_ctx.state;
-      digitalWrite(LED_BUILTIN, led_ctx.state);
+      sc_out_write(LED_BUILTIN, led_ctx.state);
     }
   } else {
     // 수동 모드
     if (led_ctx.state != led_ctx.manual_state) {
       led_ctx.state = led_ctx.manual_state;
-      digitalWrite(LED_BUILTIN, led_ctx.state);
+      sc_out_write(LED_BUILTIN, led_ctx.state);
     }
   }
 }
@@ -69,7 +70,7 @@ void led_set_state(bool state)
   if (!led_ctx.blink_enabled) {
     // 수동 모드에서만 즉시 적용
     led_ctx.state = led_ctx.manual_state;
-    digitalWrite(LED_BUILTIN, led_ctx.state);
+    sc_out_write(LED_BUILTIN, led_ctx.state);
   }
   
   Serial.print(F("[LED] Manual state set to "));
@@ -87,7 +88,7 @@ void led_set_blink_enable(bool enable)
   } else {
     // 수동 모드로 전환
     led_ctx.state = led_ctx.manual_state;
-    digitalWrite(LED_BUILTIN, led_ctx.state);
+    sc_out_write(LED_BUILTIN, led_ctx.state);
     Serial.println(F("[LED] Switched to MANUAL mode"));
   }
 }
\ No newline at end of file
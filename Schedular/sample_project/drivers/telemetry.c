@@ -0,0 +1,242 @@
+/* telemetry.c */
+#include "telemetry.h"
+#include "driver_manager.h"
+#include "led_driver.h"
+#include "adc_driver.h"
+#include "sched_sync.h"
+#include <string.h>
+#include <Arduino.h>
+
+// 외부 스케줄러 변수
+extern volatile uint32_t g_tick_ms;
+
+// 텔레메트리 내부 상태
+static struct {
+  tlm_parser_t   parser;
+  tlm_stats_fn_t sched_fn;
+  tlm_stats_fn_t fault_fn;
+  uint8_t        stream_on;
+  uint8_t        stream_every;   // N 샘플마다 1개 전송
+  uint8_t        stream_skip;
+  uint8_t        evt_seq;
+  uint8_t        req_seq;        // 이 보드가 보내는 요청 (시각 동기)
+  uint32_t       last_adc_ms;    // 마지막으로 본 ADC 샘플 시각
+  sc_sync_t*     sync;           // 시각 동기 슬레이브 (NULL = 응답만)
+  sc_time_t      rx_us;          // 처리 중인 프레임 수신 시각
+  uint8_t        idle_rx;        // loop() 의 telemetry_idle() 이 수신을 맡음
+  telemetry_stats_t stats;
+} tlm_ctx;
+
+// payload 를 프레임으로 감싸 전송
+static void tlm_send(const uint8_t* payload, uint8_t len)
+{
+  uint8_t frame[TLM_MAX_FRAME];
+  uint8_t n = tlm_frame_encode(payload, len, frame);
+  if (n) Serial.write(frame, n);
+}
+
+// 드라이버 목록: first 부터 payload 에 들어가는 만큼
+static uint8_t tlm_fill_drivers(uint8_t first, uint8_t* buf, uint8_t cap)
+{
+  driver_manager_stats_t st;
+  driver_manager_get_stats(&st);
+
+  uint8_t n = 0;
+  buf[n++] = st.count;
+  for (uint8_t i = first; i < st.count; i++) {
+    driver_info_t drv;
+    if (driver_manager_get(i, &drv) != 0) break;
+    uint8_t name_len = (uint8_t)strlen(drv.name);
+    if (n + 5 + name_len + 1 > cap) break;
+    buf[n++] = i;
+    buf[n++] = drv.period_ms;
+    buf[n++] = drv.enabled;
+    tlm_put_u16(&buf[n], st.stack_max[i]);
+    n += 2;
+    memcpy(&buf[n], drv.name, name_len + 1);
+    n += name_len + 1;
+  }
+  return n;
+}
+
+// 요청 1개 처리 → 응답 전송
+static void tlm_handle(const uint8_t* req, uint8_t len)
+{
+  uint8_t resp[TLM_MAX_PAYLOAD];
+  const uint8_t* arg = &req[2];
+  uint8_t arg_len = len - 2;
+  uint8_t n = 3;                       // type, seq, status
+  uint8_t st = TLM_ST_OK;
+
+  resp[0] = req[0] | TLM_RESP;
+  resp[1] = req[1];
+
+  switch (req[0]) {
+    case TLM_CMD_PING:
+      tlm_put_u32(&resp[n], g_tick_ms);
+      n += 4;
+      break;
+
+    case TLM_CMD_GET_SCHED:
+    case TLM_CMD_GET_FAULTS: {
+      tlm_stats_fn_t fn = (req[0] == TLM_CMD_GET_SCHED) ? tlm_ctx.sched_fn : tlm_ctx.fault_fn;
+      if (!fn) { st = TLM_ST_NO_PROVIDER; break; }
+      n += fn(&resp[n], (uint8_t)(sizeof(resp) - n));
+      break;
+    }
+
+    case TLM_CMD_GET_DRIVERS:
+      n += tlm_fill_drivers(arg_len ? arg[0] : 0, &resp[n], (uint8_t)(sizeof(resp) - n));
+      break;
+
+    case TLM_CMD_DRV_ENABLE: {
+      // 이름은 널 종료가 없을 수 있으므로 복사해서 종료
+      char name[16];
+      if (arg_len < 2 || arg_len - 1 >= (int)sizeof(name)) { st = TLM_ST_BAD_LEN; break; }
+      memcpy(name, &arg[1], arg_len - 1);
+      name[arg_len - 1] = '\0';
+      if (driver_set_enable(name, arg[0] != 0) != 0) st = TLM_ST_NOT_FOUND;
+      break;
+    }
+
+    case TLM_CMD_LED_RATE:
+      if (arg_len != 2) { st = TLM_ST_BAD_LEN; break; }
+      if (tlm_get_u16(arg) == 0) { st = TLM_ST_BAD_ARG; break; }
+      led_set_blink_rate(tlm_get_u16(arg));
+      break;
+
+    case TLM_CMD_ADC_VREF: {
+      if (arg_len != 2) { st = TLM_ST_BAD_LEN; break; }
+      uint16_t mv = tlm_get_u16(arg);
+      if (mv == 0 || mv > 5500) { st = TLM_ST_BAD_ARG; break; }
+      adc_set_reference_voltage(mv / 1000.0f);
+      break;
+    }
+
+    case TLM_CMD_ADC_STREAM:
+      if (arg_len != 2) { st = TLM_ST_BAD_LEN; break; }
+      tlm_ctx.stream_on = arg[0] ? 1 : 0;
+      tlm_ctx.stream_every = arg[1] ? arg[1] : 1;
+      tlm_ctx.stream_skip = 0;
+      break;
+
+    case TLM_CMD_SYNC: {
+      // 마스터 역할: t2 = 프레임 수신 시각, t3 = 지금 (바로 전송)
+      uint8_t k = sc_sync_answer(arg, arg_len, tlm_ctx.rx_us, sc_time_us(), &resp[n]);
+      if (!k) { st = TLM_ST_BAD_LEN; break; }
+      n += k;
+      break;
+    }
+
+    default:
+      st = TLM_ST_BAD_CMD;
+      break;
+  }
+
+  resp[2] = st;
+  if (st != TLM_ST_OK) n = 3;
+  tlm_send(resp, n);
+}
+
+// 새 ADC 샘플이 있으면 N 개마다 1개 전송 (TX 여유 없으면 버림)
+static void tlm_stream_adc(void)
+{
+  const adc_data_t* adc = adc_get_data();
+  if (!adc->valid || adc->timestamp_ms == tlm_ctx.last_adc_ms) return;
+  tlm_ctx.last_adc_ms = adc->timestamp_ms;
+
+  if (++tlm_ctx.stream_skip < tlm_ctx.stream_every) return;
+  tlm_ctx.stream_skip = 0;
+
+  uint8_t evt[8];
+  evt[0] = TLM_EVT_ADC_SAMPLE;
+  evt[1] = tlm_ctx.evt_seq++;
+  tlm_put_u32(&evt[2], adc->timestamp_ms);
+  tlm_put_u16(&evt[6], adc->raw);
+
+  // 최악 프레임 길이 = payload + crc + 3
+  if (Serial.availableForWrite() < (int)(sizeof(evt) + 5)) {
+    tlm_ctx.stats.stream_dropped++;
+    return;
+  }
+  tlm_send(evt, sizeof(evt));
+  tlm_ctx.stats.stream_sent++;
+}
+
+// 수신 바이트를 최대 TLM_RX_BUDGET 개 처리 (요청 → 응답, 시각 동기 응답 → sc_sync)
+static void tlm_rx(void)
+{
+  uint8_t payload[TLM_MAX_PAYLOAD];
+  uint8_t len;
+
+  for (uint8_t budget = TLM_RX_BUDGET; budget && Serial.available() > 0; budget--) {
+    int r = tlm_parser_feed(&tlm_ctx.parser, (uint8_t)Serial.read(), payload, &len);
+    if (r < 0) {
+      tlm_ctx.stats.rx_errors++;
+    } else if (r > 0) {
+      tlm_ctx.stats.rx_frames++;
+      tlm_ctx.rx_us = sc_time_us();
+      if (payload[0] < TLM_RESP) {
+        tlm_handle(payload, len);
+      } else if (payload[0] == (TLM_CMD_SYNC | TLM_RESP) && tlm_ctx.sync && len > 3 && payload[2] == TLM_ST_OK) {
+        sc_sync_input(tlm_ctx.sync, &payload[3], (uint8_t)(len - 3), tlm_ctx.rx_us);
+      }                                                    // 그 외 응답/에코 프레임 무시
+    }
+  }
+}
+
+int telemetry_init(void)
+{
+  tlm_stats_fn_t sched_fn = tlm_ctx.sched_fn;   // 제공자/동기 인스턴스는 init 전에 등록될 수 있음
+  tlm_stats_fn_t fault_fn = tlm_ctx.fault_fn;
+  sc_sync_t* sync = tlm_ctx.sync;
+  memset(&tlm_ctx, 0, sizeof(tlm_ctx));
+  tlm_ctx.sched_fn = sched_fn;
+  tlm_ctx.fault_fn = fault_fn;
+  tlm_ctx.sync = sync;
+  tlm_ctx.stream_every = 1;
+  tlm_parser_init(&tlm_ctx.parser);
+  return 0;
+}
+
+void telemetry_task(void)
+{
+  if (!tlm_ctx.idle_rx) tlm_rx();   // idle 이 돌면 수신은 idle 에서만 (요청 수신 시각 t2 지연 방지)
+  if (tlm_ctx.stream_on) tlm_stream_adc();
+}
+
+int telemetry_idle(void)
+{
+  tlm_ctx.idle_rx = 1;
+  tlm_rx();
+  return tlm_ctx.sync ? sc_sync_poll(tlm_ctx.sync, sc_time_us()) : 0;
+}
+
+void telemetry_sync_send(const uint8_t* data, uint8_t len)
+{
+  uint8_t req[TLM_MAX_PAYLOAD];
+  if (len > TLM_MAX_PAYLOAD - 2) return;
+  req[0] = TLM_CMD_SYNC;
+  req[1] = tlm_ctx.req_seq++;
+  memcpy(&req[2], data, len);
+  tlm_send(req, (uint8_t)(len + 2));
+}
+
+void telemetry_sync_attach(sc_sync_t* sync)
+{
+  tlm_ctx.sync = sync;
+}
+
+int telemetry_set_provider(uint8_t cmd, tlm_stats_fn_t fn)
+{
+  if (cmd == TLM_CMD_GET_SCHED)       tlm_ctx.sched_fn = fn;
+  else if (cmd == TLM_CMD_GET_FAULTS) tlm_ctx.fault_fn = fn;
+  else return -2;
+  return 0;
+}
+
+void telemetry_get_stats(telemetry_stats_t* out)
+{
+  if (!out) return;
+  *out = tlm_ctx.stats;
+}
@@ -0,0 +1,84 @@
+/* telemetry.h */
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include "tlm_proto.h"
+#include "sched_sync.h"
+
+// 태스크 1회당 처리할 최대 수신 바이트 (논블로킹 예산)
+#ifndef TLM_RX_BUDGET
+#define TLM_RX_BUDGET 32
+#endif
+
+/**
+ * @brief 통계 제공자 — 응답 data 영역에 바이너리 통계를 채움
+ * @param buf 출력 버퍼
+ * @param cap 버퍼 크기
+ * @return 채운 바이트 수
+ */
+typedef uint8_t (*tlm_stats_fn_t)(uint8_t* buf, uint8_t cap);
+
+// 텔레메트리 통계
+typedef struct {
+  uint16_t rx_frames;       // 처리한 요청 수
+  uint16_t rx_errors;       // 프레임 오류 (COBS/CRC/길이)
+  uint16_t stream_sent;     // 전송한 ADC 샘플 수
+  uint16_t stream_dropped;  // TX 버퍼 부족으로 버린 샘플 수
+} telemetry_stats_t;
+
+/**
+ * @brief 텔레메트리 초기화 (driver_init_fn_t 호환)
+ * @return 0: 성공
+ */
+int telemetry_init(void);
+
+/**
+ * @brief 텔레메트리 태스크 (저우선 드라이버로 등록 — 예: 50ms)
+ *
+ * Serial 수신 바이트를 최대 TLM_RX_BUDGET 개까지 파서에 넣고, 완성된 요청을
+ * 처리해 응답합니다. 대기하지 않으며, ADC 스트림이 켜져 있으면 새 샘플을
+ * TX 버퍼 여유가 있을 때만 보냅니다.
+ * telemetry_idle() 이 한 번이라도 불리면 수신은 idle 쪽에서만 하고 여기서는 스트림만 보냅니다.
+ */
+void telemetry_task(void);
+
+/**
+ * @brief 유휴 처리 — 메인 루프에서 드라이버 실행 후 매번 호출 (시각 동기 마스터/슬레이브 모두)
+ *
+ * 수신 처리(telemetry_task 와 같은 예산)를 idle 로 옮겨, 프레임 수신 시각(마스터 t2, 슬레이브 t4)이
+ * 50ms 드라이버 주기나 과부하 솎음만큼 늦게 찍히지 않게 합니다. 동기 인스턴스가 붙어 있으면
+ * sc_sync_poll() 로 라운드를 진행합니다 (요청은 이때만 나감).
+ * @return 1: 동기 시각축 스텝 (로그에 표시할 것), 0: 그 외
+ */
+int telemetry_idle(void);
+
+/**
+ * @brief 시각 동기 요청 송신 (sc_sync_init() 의 send 콜백으로 넘김)
+ *
+ * sc_sync 요청을 TLM_CMD_SYNC 프레임으로 보냅니다. 링크 상대(마스터 보드)의 텔레메트리가
+ * 응답하고, 응답은 수신 처리에서 붙여 둔 인스턴스로 전달됩니다.
+ * 마스터는 인스턴스 없이 TLM_CMD_SYNC 요청에 자기 시간축으로 응답합니다 — 단 loop() 에서
+ * telemetry_idle() 을 불러야 요청 수신 시각(t2)이 정확합니다 (없으면 최대 반 주기 오프셋 편향).
+ */
+void telemetry_sync_send(const uint8_t* data, uint8_t len);
+
+/**
+ * @brief 시각 동기 슬레이브 인스턴스 연결 (NULL = 해제)
+ */
+void telemetry_sync_attach(sc_sync_t* sync);
+
+/**
+ * @brief 통계 제공자 등록
+ * @param cmd TLM_CMD_GET_SCHED 또는 TLM_CMD_GET_FAULTS
+ * @param fn  제공자 (NULL = 해제 → TLM_ST_NO_PROVIDER 응답)
+ * @return 0: 성공, -2: 잘못된 파라미터
+ */
+int telemetry_set_provider(uint8_t cmd, tlm_stats_fn_t fn);
+
+/**
+ * @brief 텔레메트리 통계 조회
+ */
+void telemetry_get_stats(telemetry_stats_t* out);
+
+#endif // TELEMETRY_H
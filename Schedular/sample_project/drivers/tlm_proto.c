@@ -0,0 +1,98 @@
+/* tlm_proto.c */
+#include "tlm_proto.h"
+#include <string.h>
+
+uint16_t tlm_crc16(const uint8_t* data, uint8_t len)
+{
+  uint16_t crc = 0xFFFF;
+  while (len--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t b = 0; b < 8; b++) {
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+uint8_t tlm_frame_encode(const uint8_t* payload, uint8_t len, uint8_t* out)
+{
+  if (len > TLM_MAX_PAYLOAD) return 0;
+
+  uint8_t raw[TLM_MAX_PAYLOAD + 2];
+  memcpy(raw, payload, len);
+  tlm_put_u16(&raw[len], tlm_crc16(payload, len));
+  uint8_t n = len + 2;
+
+  // COBS: 각 블록 앞에 다음 0 까지의 거리(code)를 둔다 (254 바이트 미만이므로 블록 분할 없음)
+  out[0] = 0x00;  // 재동기 구분자
+  uint8_t code_pos = 1;
+  uint8_t code = 1;
+  uint8_t o = 2;
+  for (uint8_t i = 0; i < n; i++) {
+    if (raw[i] == 0) {
+      out[code_pos] = code;
+      code_pos = o++;
+      code = 1;
+    } else {
+      out[o++] = raw[i];
+      code++;
+    }
+  }
+  out[code_pos] = code;
+  out[o++] = 0x00;  // 프레임 구분자
+  return o;
+}
+
+void tlm_parser_init(tlm_parser_t* p)
+{
+  memset(p, 0, sizeof(*p));
+}
+
+// 버퍼에 모인 COBS 블록을 제자리 복원 → 복원 길이, 오류 시 -1
+static int cobs_decode_inplace(uint8_t* buf, uint8_t len)
+{
+  uint8_t i = 0, o = 0;
+  while (i < len) {
+    uint8_t code = buf[i++];
+    if (code == 0) return -1;
+    for (uint8_t k = 1; k < code; k++) {
+      if (i >= len) return -1;
+      buf[o++] = buf[i++];
+    }
+    if (code < 0xFF && i < len) buf[o++] = 0;
+  }
+  return o;
+}
+
+int tlm_parser_feed(tlm_parser_t* p, uint8_t byte, uint8_t* out, uint8_t* out_len)
+{
+  if (byte != 0x00) {
+    if (p->len >= sizeof(p->buf)) {
+      p->overflow = 1;
+    } else {
+      p->buf[p->len++] = byte;
+    }
+    return 0;
+  }
+
+  // 프레임 끝
+  uint8_t len = p->len;
+  uint8_t overflow = p->overflow;
+  p->len = 0;
+  p->overflow = 0;
+  if (len == 0) return 0;  // 연속 구분자 (재동기용) 무시
+
+  int n = overflow ? -1 : cobs_decode_inplace(p->buf, len);
+  if (n < 4 || n - 2 > TLM_MAX_PAYLOAD) {
+    p->framing_errors++;
+    return -1;
+  }
+  uint8_t plen = (uint8_t)(n - 2);
+  if (tlm_crc16(p->buf, plen) != tlm_get_u16(&p->buf[plen])) {
+    p->crc_errors++;
+    return -1;
+  }
+  memcpy(out, p->buf, plen);
+  *out_len = plen;
+  return 1;
+}
@@ -0,0 +1,95 @@
+/* tlm_proto.h */
+#ifndef TLM_PROTO_H
+#define TLM_PROTO_H
+
+/*
+ * 텔레메트리/명령 프로토콜 — 프레임 코덱 (Arduino/호스트 공용, 하드웨어 의존 없음)
+ *
+ * 프레임:  0x00 COBS( payload | crc16_le ) 0x00
+ *          앞쪽 0x00 은 같은 시리얼에 섞인 텍스트 로그를 끊어내는 재동기용
+ * payload: [type][seq][data...]
+ *   - 요청:  type = TLM_CMD_xxx,           seq = 호스트가 정함
+ *   - 응답:  type = TLM_CMD_xxx | 0x80,    seq = 요청 seq, data[0] = TLM_ST_xxx
+ *   - 스트림: type = TLM_EVT_xxx (0xC0~), seq = 이벤트 카운터
+ * 다중 바이트 필드는 little endian
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TLM_MAX_PAYLOAD   64                        // type + seq + data
+#define TLM_MAX_FRAME     (TLM_MAX_PAYLOAD + 2 + 3) // + crc16 + COBS 오버헤드(1) + 구분자(2)
+
+// 명령
+#define TLM_CMD_PING          0x01  // → data: 없음            ← u32 tick_ms
+#define TLM_CMD_GET_SCHED     0x02  // → 없음                  ← 스케줄러 통계 (제공자 정의)
+#define TLM_CMD_GET_DRIVERS   0x03  // → u8 first              ← u8 total, {u8 idx, u8 period, u8 enabled, u16 stack, name\0}...
+#define TLM_CMD_GET_FAULTS    0x04  // → 없음                  ← Fault 통계 (제공자 정의)
+#define TLM_CMD_DRV_ENABLE    0x05  // → u8 enable, name       ← 없음
+#define TLM_CMD_LED_RATE      0x06  // → u16 rate_ms           ← 없음
+#define TLM_CMD_ADC_VREF      0x07  // → u16 vref_mv           ← 없음
+#define TLM_CMD_ADC_STREAM    0x08  // → u8 enable, u8 every_n ← 없음
+#define TLM_CMD_SYNC          0x09  // → sc_sync 요청 (16)     ← sc_sync 응답 (16) — 보드 간 시각 동기 (sched_sync.h)
+
+#define TLM_RESP              0x80  // 응답 비트
+
+// 비동기 이벤트
+#define TLM_EVT_ADC_SAMPLE    0xC0  // u32 timestamp_ms, u16 raw
+
+// 응답 상태 (응답 data[0])
+#define TLM_ST_OK             0
+#define TLM_ST_BAD_CMD        1
+#define TLM_ST_BAD_LEN        2
+#define TLM_ST_NOT_FOUND      3
+#define TLM_ST_BAD_ARG        4
+#define TLM_ST_NO_PROVIDER    5
+
+// 수신 파서 (바이트 단위 증분 처리)
+typedef struct {
+  uint8_t  buf[TLM_MAX_FRAME];
+  uint8_t  len;
+  uint8_t  overflow;     // 현재 프레임 버림 (다음 0x00 까지)
+  uint16_t crc_errors;   // 통계
+  uint16_t framing_errors;
+} tlm_parser_t;
+
+/**
+ * @brief CRC-16/CCITT-FALSE
+ */
+uint16_t tlm_crc16(const uint8_t* data, uint8_t len);
+
+/**
+ * @brief payload → 전송 프레임 (0x00 + COBS(payload + crc) + 0x00)
+ * @param out 최소 TLM_MAX_FRAME 바이트
+ * @return 프레임 길이, 0: payload 가 너무 김
+ */
+uint8_t tlm_frame_encode(const uint8_t* payload, uint8_t len, uint8_t* out);
+
+/**
+ * @brief 파서 초기화
+ */
+void tlm_parser_init(tlm_parser_t* p);
+
+/**
+ * @brief 수신 바이트 1개 처리
+ * @param out     완성된 payload 저장 위치 (최소 TLM_MAX_PAYLOAD)
+ * @param out_len 완성된 payload 길이
+ * @return 1: payload 완성, 0: 진행 중, -1: 프레임 오류(COBS/CRC/길이) — 버림
+ */
+int tlm_parser_feed(tlm_parser_t* p, uint8_t byte, uint8_t* out, uint8_t* out_len);
+
+// little endian 필드 헬퍼
+static inline void tlm_put_u16(uint8_t* p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static inline void tlm_put_u32(uint8_t* p, uint32_t v) { tlm_put_u16(p, (uint16_t)v); tlm_put_u16(p + 2, (uint16_t)(v >> 16)); }
+static inline uint16_t tlm_get_u16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static inline uint32_t tlm_get_u32(const uint8_t* p) { return tlm_get_u16(p) | ((uint32_t)tlm_get_u16(p + 2) << 16); }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TLM_PROTO_H
@@ -18,20 +18,33 @@
  */
 
 // 드라이버 헤더 파일들 포함
+#include "sched_port.h"
+#include "sched_input.h"
 #include "drivers/driver_manager.h"
 #include "drivers/led_driver.h"
 #include "drivers/button_driver.h"
 #include "drivers/adc_driver.h"
+#include "drivers/telemetry.h"
 
-// 스케줄러 변수들 (실제로는 ultra_light_sched에서 제공되어야 함)
-// 이 예제에서는 간단한 구현으로 대체
-volatile uint32_t g_tick_ms = 0;
-volatile uint8_t g_flag_10ms = 0;
-volatile uint8_t g_flag_50ms = 0;
+// 1: 텍스트 명령 대신 바이너리 텔레메트리 프로토콜 사용 (tools/tlm_cli)
+#ifndef USE_TELEMETRY
+#define USE_TELEMETRY 0
+#endif
+
+// 1: 보드 간 시각 동기 슬레이브 — 텔레메트리 링크 상대(마스터 보드)에 TLM_CMD_SYNC 요청
+//    마스터 보드는 USE_TELEMETRY 만 켜면 응답함 (loop() 의 telemetry_idle() 에서 수신). 로그 스탬프(트레이스)는 마스터 시간축
+#ifndef USE_TIME_SYNC
+#define USE_TIME_SYNC 0
+#endif
+#if USE_TIME_SYNC && !USE_TELEMETRY
+#error "USE_TIME_SYNC requires USE_TELEMETRY"
+#endif
+#if USE_TIME_SYNC && DRIVER_TRACE
+#include "trace.h"
+#endif
 
-// 타이머 카운터
-static uint8_t timer_10ms_count = 0;
-static uint8_t timer_50ms_count = 0;
+// 스케줄러 타임베이스 (틱 소스는 core/sched_port, 드라이버 주기는 sched_core 가 관리)
+volatile uint32_t g_tick_ms = 0;
 
 // 공유 데이터 (드라이버 간 통신용)
 typedef struct {
@@ -42,58 +55,33 @@ typedef struct {
 
 shared_data_t g_shared_data = {0};
 
+#if USE_TIME_SYNC
+// 1초마다 4회 교환, 최대 1ms/100ms 슬루, 500ms 이상 어긋나면 스텝
+static sc_sync_t s_sync;
+
+// 동기 시각 (ms) — 로그 스탬프용, 스케줄러 주기는 g_tick_ms 그대로
+static uint32_t sync_clock(void)
+{
+  return sc_sync_stamp(&s_sync, g_tick_ms);
+}
+#endif
+
 // ===== 간단한 스케줄러 구현 =====
 
-// 1ms 타이머 인터럽트 시뮬레이션
+// 1ms 틱 (sched_port_avr 의 Timer2 ISR 에서 호출)
 void timer_interrupt_1ms(void)
 {
   g_tick_ms++;
-  
-  // 10ms 플래그
-  timer_10ms_count++;
-  if (timer_10ms_count >= 10) {
-    timer_10ms_count = 0;
-    g_flag_10ms = 1;
-  }
-  
-  // 50ms 플래그
-  timer_50ms_count++;
-  if (timer_50ms_count >= 50) {
-    timer_50ms_count = 0;
-    g_flag_50ms = 1;
-  }
+  sc_in_capture(g_tick_ms);   // 입력 포트 래치 (드라이버는 스냅샷을 읽음)
 }
 
-// 간단한 타이머 설정 (실제로는 timer2_setup_1ms() 함수 사용)
+// 1ms 틱 소스 시작 (Timer2 CTC, 16MHz / 64 → OCR2A = 249)
 void timer_setup_1ms(void)
 {
-  // Timer1을 1ms 주기로 설정 (16MHz 기준)
-  noInterrupts();
-  
-  TCCR1A = 0;
-  TCCR1B = 0;
-  TCNT1 = 0;
-  
-  // 1ms = 16000 클럭 (16MHz / 1000Hz)
-  // 프리스케일러 64 사용: 16MHz / 64 = 250kHz
-  // 250 카운트 = 1ms
-  OCR1A = 249;  // (250 - 1)
-  
-  TCCR1B |= (1 << WGM12);   // CTC 모드
-  TCCR1B |= (1 << CS11) | (1 << CS10); // 64 프리스케일러
-  TIMSK1 |= (1 << OCIE1A); // 비교 일치 인터럽트 활성화
-  
-  interrupts();
-  
+  sc_port_tick_start(1, timer_interrupt_1ms);
   Serial.println(F("[TIMER] 1ms timer initialized"));
 }
 
-// Timer1 비교 일치 인터럽트 서비스 루틴
-ISR(TIMER1_COMPA_vect)
-{
-  timer_interrupt_1ms();
-}
-
 // ===== 버튼 이벤트 핸들러 =====
 
 void on_button_event(uint8_t button_id, uint8_t pressed)
@@ -156,6 +144,18 @@ void system_status_task(void)
     
     Serial.print(F("Button count: "));
     Serial.println(button_get_press_count());
+
+#if USE_TIME_SYNC
+    sc_sync_stats_t sy;
+    sc_sync_get_stats(&s_sync, &sy);
+    Serial.print(F("Sync: "));
+    Serial.print(sync_clock());
+    Serial.print(sy.state == SC_SYNC_LOCKED ? F(" ms (locked, drift ") : F(" ms (unsync, drift "));
+    Serial.print(sy.drift_ppb / 1000);
+    Serial.print(F("ppm, rtt "));
+    Serial.print(sy.rtt_us);
+    Serial.println(F("us)"));
+#endif
     
     Serial.print(F("Free RAM: "));
     Serial.println(freeRam());
@@ -171,6 +171,29 @@ int freeRam(void)
   return (int) &v - (__brkval == 0 ? (int) &__heap_start : (int) __brkval);
 }
 
+// ===== 텔레메트리 통계 제공자 =====
+
+// GET_SCHED 응답: u32 uptime_ms, u8 count, u8 hwm, u8 cap, u16 register_fail, u16 slot_full,
+//                  u8 load_level, u16 load_enters, u16 load_recovers, u32 shed, u32 missed
+uint8_t tlm_sched_stats(uint8_t* buf, uint8_t cap)
+{
+  driver_manager_stats_t st;
+  if (cap < 24) return 0;
+  driver_manager_get_stats(&st);
+  tlm_put_u32(&buf[0], g_tick_ms);
+  buf[4] = st.count;
+  buf[5] = st.hwm;
+  buf[6] = st.cap;
+  tlm_put_u16(&buf[7], st.register_fail);
+  tlm_put_u16(&buf[9], st.slot_full);
+  buf[11] = st.load.level;
+  tlm_put_u16(&buf[12], st.load.enters);
+  tlm_put_u16(&buf[14], st.load.recovers);
+  tlm_put_u32(&buf[16], st.load.shed);
+  tlm_put_u32(&buf[20], st.load.missed);
+  return 24;
+}
+
 // ===== 시리얼 명령어 처리 =====
 
 void process_serial_commands(void)
@@ -239,6 +262,14 @@ void process_serial_commands(void)
 
 // ===== Arduino 메인 함수들 =====
 
+// ===== 드라이버 설정 (플래시 상주, RAM 은 드라이버당 디스크립터 4바이트) =====
+DRIVER_CONFIG(cfg_led,    "LED",    led_driver_init,    led_driver_task,    10, SC_CRIT_NORMAL);
+DRIVER_CONFIG(cfg_button, "Button", button_driver_init, button_driver_task, 10, SC_CRIT_NORMAL);
+DRIVER_CONFIG(cfg_adc,    "ADC",    adc_driver_init,    adc_driver_task,    50, SC_CRIT_NORMAL);
+#if USE_TELEMETRY
+DRIVER_CONFIG(cfg_tlm,    "TLM",    telemetry_init,     telemetry_task,     50, SC_CRIT_LOW);  // 과부하 시 먼저 솎음 (응답이 늦어질 뿐)
+#endif
+
 void setup()
 {
   // 시리얼 통신 초기화
@@ -257,20 +288,38 @@ void setup()
   // 드라이버들을 동적으로 등록
   int ret;
   
-  ret = driver_register("LED", led_driver_init, led_driver_task, 10);
+  ret = driver_register_P(&cfg_led);
   if (ret != 0) {
     Serial.println(F("ERROR: LED driver registration failed"));
   }
   
-  ret = driver_register("Button", button_driver_init, button_driver_task, 10);
+  ret = driver_register_P(&cfg_button);
   if (ret != 0) {
     Serial.println(F("ERROR: Button driver registration failed"));
   }
   
-  ret = driver_register("ADC", adc_driver_init, adc_driver_task, 50);
+  ret = driver_register_P(&cfg_adc);
   if (ret != 0) {
     Serial.println(F("ERROR: ADC driver registration failed"));
   }
+
+#if USE_TELEMETRY
+  // 저우선 50ms 드라이버로 ADC 스트리밍 (ADC 뒤에 등록 → 같은 주기의 새 샘플). 수신은 loop() 의 telemetry_idle()
+  telemetry_set_provider(TLM_CMD_GET_SCHED, tlm_sched_stats);
+  ret = driver_register_P(&cfg_tlm);
+  if (ret != 0) {
+    Serial.println(F("ERROR: Telemetry registration failed"));
+  }
+#endif
+
+#if USE_TIME_SYNC
+  // 동기 트래픽은 loop() 의 telemetry_idle() 에서만 나감
+  sc_sync_init(&s_sync, telemetry_sync_send, 1000, 4, 100, 500);
+  telemetry_sync_attach(&s_sync);
+#if DRIVER_TRACE
+  trace_set_clock(sync_clock);
+#endif
+#endif
   
   // 버튼 이벤트 콜백 등록
   button_register_callback(on_button_event);
@@ -292,7 +341,18 @@ void loop()
   
   // 시스템 태스크들
   system_status_task();
+#if USE_TELEMETRY
+  // 유휴 처리: 수신 (+ 동기 라운드) — 마스터도 필요 (TLM_CMD_SYNC 수신 시각)
+  int stepped = telemetry_idle();
+#if USE_TIME_SYNC && DRIVER_TRACE
+  if (stepped) trace_reset();   // 시각축 스텝 — 이전 시각축 레코드는 비움
+#else
+  (void)stepped;
+#endif
+#endif
+#if !USE_TELEMETRY
   process_serial_commands();
+#endif
   
   // 공유 데이터 업데이트
   g_shared_data.system_uptime = g_tick_ms;
@@ -7,45 +7,24 @@
  * 드라이버 동적 등록 시스템의 기본 사용법을 보여줍니다.
  */
 
+#include "sched_port.h"
+#include "sched_input.h"
 #include "drivers/driver_manager.h"
 #include "drivers/led_driver.h"
 
-// 스케줄러 변수들 (간단한 구현)
+// 스케줄러 변수 (틱 소스는 core/sched_port — 10ms/50ms 실행 시점은 드라이버 매니저가 관리)
 volatile uint32_t g_tick_ms = 0;
-volatile uint8_t g_flag_10ms = 0;
-volatile uint8_t g_flag_50ms = 0;
 
-static uint8_t timer_10ms_count = 0;
-
-// 1ms 타이머 인터럽트
+// 1ms 틱 (sched_port_avr 의 Timer2 ISR 에서 호출)
 void timer_interrupt_1ms(void)
 {
   g_tick_ms++;
-  
-  timer_10ms_count++;
-  if (timer_10ms_count >= 10) {
-    timer_10ms_count = 0;
-    g_flag_10ms = 1;
-  }
+  sc_in_capture(g_tick_ms);   // 입력 포트 래치 (드라이버는 스냅샷을 읽음)
 }
 
-// Timer1 설정 (1ms 주기)
 void timer_setup_1ms(void)
 {
-  noInterrupts();
-  TCCR1A = 0;
-  TCCR1B = 0;
-  TCNT1 = 0;
-  OCR1A = 249;  // 1ms @ 16MHz with 64 prescaler
-  TCCR1B |= (1 << WGM12);   // CTC mode
-  TCCR1B |= (1 << CS11) | (1 << CS10); // 64 prescaler
-  TIMSK1 |= (1 << OCIE1A); // Enable interrupt
-  interrupts();
-}
-
-ISR(TIMER1_COMPA_vect)
-{
-  timer_interrupt_1ms();
+  sc_port_tick_start(1, timer_interrupt_1ms);
 }
 
 void setup()
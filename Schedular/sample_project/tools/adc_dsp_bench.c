@@ -0,0 +1,288 @@
+/* adc_dsp_bench.c */
+/*
+ * ADC DSP 커널 벤치마크 (호스트) — 고정소수점(adc_dsp.c) vs float 기준 구현
+ *
+ *   gcc -O3 -Wall -I../drivers adc_dsp_bench.c ../drivers/adc_dsp.c -lm -o adc_dsp_bench
+ *   gcc -O3 -fno-tree-vectorize -Wall -I../drivers adc_dsp_bench.c ../drivers/adc_dsp.c -lm -o adc_dsp_bench_novec
+ *
+ *   ./adc_dsp_bench [repeat]
+ *
+ * 같은 샘플 스트림(10비트, 사인 + 잡음 + 스파이크)을 두 구현에 통과시켜
+ * 샘플당 시간(ns)과 float 대비 최대 오차(LSB)를 출력한다.
+ * 블록은 링 버퍼와 같은 크기로 잘라 제자리 처리한다.
+ * 마지막 fullscale 줄은 int16 풀스케일 / 5000mV 환산 블록을 한 누산기에 여러 번 더해
+ * 창 통계 범위(제곱합 넘침)를 검사한다 — 오차가 1 LSB 를 넘으면 종료 코드 1.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "adc_dsp.h"
+
+#define BENCH_SAMPLES  4096
+#define BENCH_BLOCK    64      // 링 블록 크기
+#define BENCH_MEDIAN_N 5
+#define BENCH_EMA_SHIFT 3      // 알파 = 1/8
+#define BENCH_PERIOD_MS 50     // adc_driver_task 주기
+
+static int16_t s_input[BENCH_SAMPLES];
+static int16_t s_work[BENCH_SAMPLES];
+static float   s_fwork[BENCH_SAMPLES];
+static volatile int32_t s_sink;
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* 결정적 입력: 512 ± 300 사인 + 균등 잡음 ±8 + 64 샘플마다 스파이크 */
+static void make_input(void)
+{
+  uint32_t lcg = 12345;
+  for (int i = 0; i < BENCH_SAMPLES; ++i) {
+    lcg = lcg * 1103515245u + 12345u;
+    int noise = (int)((lcg >> 16) % 17) - 8;
+    int v = 512 + (int)lrint(300.0 * sin(i * 0.02)) + noise;
+    if ((i % 64) == 17) v = (i & 128) ? 1023 : 0;
+    if (v < 0) v = 0;
+    if (v > 1023) v = 1023;
+    s_input[i] = (int16_t)v;
+  }
+}
+
+/* ===== float 기준 구현 ===== */
+
+static void f_median(float* x, int n, int win)
+{
+  float hist[DSP_MEDIAN_MAX], tmp[DSP_MEDIAN_MAX];
+  int fill = 0, pos = 0;
+  for (int i = 0; i < n; ++i) {
+    hist[pos] = x[i];
+    pos = (pos + 1) % win;
+    if (fill < win) fill++;
+    memcpy(tmp, hist, sizeof(float) * fill);
+    for (int a = 1; a < fill; ++a) {            // 매 샘플 창 전체 정렬
+      float v = tmp[a];
+      int b = a;
+      while (b > 0 && tmp[b - 1] > v) { tmp[b] = tmp[b - 1]; b--; }
+      tmp[b] = v;
+    }
+    x[i] = tmp[fill / 2];
+  }
+}
+
+static void f_ema(float* x, int n, float alpha)
+{
+  float y = x[0];
+  for (int i = 0; i < n; ++i) {
+    y += alpha * (x[i] - y);
+    x[i] = y;
+  }
+}
+
+static void f_stats(const float* x, int n, float* mn, float* mx, float* mean, float* rms)
+{
+  float lo = x[0], hi = x[0], s = 0, sq = 0;
+  for (int i = 0; i < n; ++i) {
+    lo = fminf(lo, x[i]);
+    hi = fmaxf(hi, x[i]);
+    s += x[i];
+    sq += x[i] * x[i];
+  }
+  *mn = lo; *mx = hi; *mean = s / n; *rms = sqrtf(sq / n);
+}
+
+static void f_roc(float* x, int n, float prev, float dt_s)
+{
+  for (int i = 0; i < n; ++i) {
+    float v = x[i];
+    x[i] = (v - prev) / dt_s;
+    prev = v;
+  }
+}
+
+/* ===== 측정 ===== */
+
+typedef struct {
+  const char* name;
+  double fixed_ns;
+  double float_ns;
+  double max_err;
+} result_t;
+
+static void report(const result_t* r)
+{
+  printf("%-8s fixed %7.2f ns/sample   float %7.2f ns/sample   x%5.2f   max|err| %.2f\n",
+         r->name, r->fixed_ns, r->float_ns, r->float_ns / r->fixed_ns, r->max_err);
+}
+
+static void to_float(void)
+{
+  for (int i = 0; i < BENCH_SAMPLES; ++i) s_fwork[i] = s_input[i];
+}
+
+static double max_err(const int16_t* a, const float* b, int n, double scale)
+{
+  double e = 0;
+  for (int i = 0; i < n; ++i) {
+    double d = fabs(a[i] - b[i] * scale);
+    if (d > e) e = d;
+  }
+  return e;
+}
+
+int main(int argc, char** argv)
+{
+  int repeat = (argc > 1) ? atoi(argv[1]) : 200;
+  if (repeat < 1) repeat = 1;
+  double total = (double)repeat * BENCH_SAMPLES;
+  double t0;
+  result_t r;
+
+  make_input();
+  printf("samples=%d block=%d repeat=%d\n", BENCH_SAMPLES, BENCH_BLOCK, repeat);
+
+  /* 메디안 */
+  r.name = "median5";
+  t0 = now_ns();
+  for (int k = 0; k < repeat; ++k) {
+    dsp_median_t m;
+    dsp_median_init(&m, BENCH_MEDIAN_N);
+    memcpy(s_work, s_input, sizeof(s_work));
+    for (int b = 0; b < BENCH_SAMPLES; b += BENCH_BLOCK) dsp_median_block(&m, &s_work[b], BENCH_BLOCK);
+    s_sink += s_work[k % BENCH_SAMPLES];
+  }
+  r.fixed_ns = (now_ns() - t0) / total;
+  t0 = now_ns();
+  for (int k = 0; k < repeat; ++k) {
+    to_float();
+    f_median(s_fwork, BENCH_SAMPLES, BENCH_MEDIAN_N);
+    s_sink += (int32_t)s_fwork[k % BENCH_SAMPLES];
+  }
+  r.float_ns = (now_ns() - t0) / total;
+  r.max_err = max_err(s_work, s_fwork, BENCH_SAMPLES, 1.0);
+  report(&r);
+
+  /* EMA */
+  r.name = "ema";
+  t0 = now_ns();
+  for (int k = 0; k < repeat; ++k) {
+    dsp_ema_t e;
+    dsp_ema_init(&e, BENCH_EMA_SHIFT);
+    memcpy(s_work, s_input, sizeof(s_work));
+    for (int b = 0; b < BENCH_SAMPLES; b += BENCH_BLOCK) dsp_ema_block(&e, &s_work[b], BENCH_BLOCK);
+    s_sink += s_work[k % BENCH_SAMPLES];
+  }
+  r.fixed_ns = (now_ns() - t0) / total;
+  t0 = now_ns();
+  for (int k = 0; k < repeat; ++k) {
+    to_float();
+    f_ema(s_fwork, BENCH_SAMPLES, 1.0f / (1 << BENCH_EMA_SHIFT));
+    s_sink += (int32_t)s_fwork[k % BENCH_SAMPLES];
+  }
+  r.float_ns = (now_ns() - t0) / total;
+  r.max_err = max_err(s_work, s_fwork, BENCH_SAMPLES, 1.0);
+  report(&r);
+
+  /* 창 통계 (블록마다 min/max/mean/rms) */
+  {
+    static dsp_stats_t fx[BENCH_SAMPLES / BENCH_BLOCK];
+    static float fl[BENCH_SAMPLES / BENCH_BLOCK][4];
+    r.name = "stats";
+    t0 = now_ns();
+    for (int k = 0; k < repeat; ++k) {
+      for (int b = 0; b < BENCH_SAMPLES; b += BENCH_BLOCK) {
+        dsp_acc_t a;
+        dsp_acc_reset(&a);
+        dsp_acc_block(&a, &s_input[b], BENCH_BLOCK);
+        dsp_acc_result(&a, &fx[b / BENCH_BLOCK]);
+      }
+      s_sink += fx[k % (BENCH_SAMPLES / BENCH_BLOCK)].rms;
+    }
+    r.fixed_ns = (now_ns() - t0) / total;
+    to_float();
+    t0 = now_ns();
+    for (int k = 0; k < repeat; ++k) {
+      for (int b = 0; b < BENCH_SAMPLES; b += BENCH_BLOCK) {
+        float* o = fl[b / BENCH_BLOCK];
+        f_stats(&s_fwork[b], BENCH_BLOCK, &o[0], &o[1], &o[2], &o[3]);
+      }
+      s_sink += (int32_t)fl[k % (BENCH_SAMPLES / BENCH_BLOCK)][3];
+    }
+    r.float_ns = (now_ns() - t0) / total;
+    r.max_err = 0;
+    for (int i = 0; i < BENCH_SAMPLES / BENCH_BLOCK; ++i) {
+      double d[4] = { fabs(fx[i].min - fl[i][0]), fabs(fx[i].max - fl[i][1]),
+                      fabs(fx[i].mean - fl[i][2]), fabs(fx[i].rms - fl[i][3]) };
+      for (int j = 0; j < 4; ++j) if (d[j] > r.max_err) r.max_err = d[j];
+    }
+    report(&r);
+  }
+
+  /* 변화율 (고정 주기 차분 → 카운트/초) */
+  r.name = "roc";
+  t0 = now_ns();
+  for (int k = 0; k < repeat; ++k) {
+    int16_t prev = s_input[0];
+    memcpy(s_work, s_input, sizeof(s_work));
+    for (int b = 0; b < BENCH_SAMPLES; b += BENCH_BLOCK) dsp_diff_block(&s_work[b], BENCH_BLOCK, &prev);
+    s_sink += s_work[k % BENCH_SAMPLES];
+  }
+  r.fixed_ns = (now_ns() - t0) / total;
+  t0 = now_ns();
+  for (int k = 0; k < repeat; ++k) {
+    to_float();
+    f_roc(s_fwork, BENCH_SAMPLES, s_input[0], BENCH_PERIOD_MS / 1000.0f);
+    s_sink += (int32_t)s_fwork[k % BENCH_SAMPLES];
+  }
+  r.float_ns = (now_ns() - t0) / total;
+  r.max_err = max_err(s_work, s_fwork, BENCH_SAMPLES, BENCH_PERIOD_MS / 1000.0);  // 차분 ↔ /s 환산
+  report(&r);
+
+  /* 스칼라 변화율 (타임스탬프 나눗셈) — adc_driver_task 경로 */
+  {
+    dsp_roc_t d;
+    dsp_roc_init(&d);
+    double e = 0;
+    for (int i = 0; i < BENCH_SAMPLES; ++i) {
+      int32_t v = dsp_roc_push(&d, s_input[i], (uint32_t)i * BENCH_PERIOD_MS);
+      if (i) {
+        double ref = (s_input[i] - s_input[i - 1]) * 1000.0 / BENCH_PERIOD_MS;
+        if (fabs(v - ref) > e) e = fabs(v - ref);
+      }
+    }
+    printf("roc_ts   max|err| %.2f counts/s\n", e);
+  }
+
+  /* 창 통계 범위 — 풀스케일 int16 사각파, 10비트 → 5000mV 환산 (블록 여러 개를 한 누산기에) */
+  {
+    double e = 0;
+    for (int c = 0; c < 2; ++c) {
+      for (int i = 0; i < BENCH_SAMPLES; ++i) {
+        if (c == 0) s_work[i] = (i & 1) ? 32767 : -32767;
+        else        s_work[i] = s_input[i];
+      }
+      if (c == 1) dsp_scale_mv_block(s_work, BENCH_SAMPLES, 5000, 10);
+      dsp_acc_t a;
+      dsp_stats_t st;
+      dsp_acc_reset(&a);
+      for (int b = 0; b < BENCH_SAMPLES; b += BENCH_BLOCK) dsp_acc_block(&a, &s_work[b], BENCH_BLOCK);
+      dsp_acc_result(&a, &st);
+      double sq = 0;
+      for (int i = 0; i < BENCH_SAMPLES; ++i) sq += (double)s_work[i] * s_work[i];
+      double d = fabs(st.rms - sqrt(sq / BENCH_SAMPLES));
+      printf("fullscale %-6s n=%u rms %u (ref %.1f)\n", c ? "5000mV" : "int16", st.n, st.rms,
+             sqrt(sq / BENCH_SAMPLES));
+      if (d > e) e = d;
+    }
+    printf("fullscale max|err| %.2f\n", e);
+    if (e > 1.0) return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,151 @@
+/* hrt_edge_sim.c */
+/*
+ * 전원 시퀀스 엣지 오차 시뮬레이션 (호스트) — 틱 폴링 vs 고해상도 타이머 큐(sched_hrt)
+ *
+ *   gcc -O2 -Wall -I../../core hrt_edge_sim.c ../../core/sched_core.c ../../core/sched_pool.c ../../core/sched_load.c ../../core/sched_hrt.c ../../core/sched_output.c ../../core/sched_port_host.c -o hrt_edge_sim
+ *
+ *   ./hrt_edge_sim [runs]              가상 시간 (결정적 — 양자화 오차만)
+ *   ./hrt_edge_sim --realtime [runs]   실제 시간 (clock_nanosleep 기상 지연 포함)
+ *
+ * 틱 경계와 무관한 시각(위상을 run 마다 바꿈)에 전원 요청이 들어오면 요청 시각 기준
+ * LCD_RST = +5ms, PON = +21ms 엣지를 두 방식으로 낸다.
+ *   polled : 1ms 틱 슬롯(sc_add_at) — 메인 루프 sc_run() 에서 핀 쓰기 (Schedulartest.ino 의 기존 경로)
+ *   hrt    : sc_hrt_pin_at() — 비교 타이머 ISR 에서 핀 쓰기
+ * 핀 쓰기 시각 - 목표 시각 = 엣지 오차.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sched_core.h"
+#include "sched_hrt.h"
+#include "sched_port.h"
+
+#define SIM_RUN_MS    30       // run 간격 (시퀀스 21ms + 여유)
+#define SIM_RUNS      20
+#define SIM_SLOTS     8
+
+/* 엣지 정의 (Schedulartest.ino power_on_sequence 와 같은 시각) */
+enum { EDGE_LCD_RST, EDGE_PON, EDGE_COUNT };
+static const char*    k_edge_name[EDGE_COUNT] = { "LCD_RST", "PON" };
+static const uint32_t k_edge_us[EDGE_COUNT]   = { 5000, 21000 };
+
+/* 가상 핀 번호: 방식별로 분리해 핀 관찰 함수에서 구분 */
+#define PIN_POLLED(e) (uint8_t)(4 + (e))
+#define PIN_HRT(e)    (uint8_t)(8 + (e))
+
+typedef struct {
+  uint32_t n;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint64_t sum_us;
+} err_acc_t;
+
+static volatile uint32_t g_tick_ms;
+static sc_task_t  s_slots[SIM_SLOTS];
+static sc_sched_t s_sched;
+static sc_time_t  s_req_us;                          // 이번 run 요청 시각
+static err_acc_t  s_err[2][EDGE_COUNT];              // [0]=polled, [1]=hrt
+static uint8_t    s_seen;                            // 이번 run 에 관찰한 엣지 수
+
+static void on_tick(void)
+{
+  g_tick_ms += sc_port_tick_period();
+}
+
+static void acc_add(err_acc_t* a, uint32_t v)
+{
+  if (!a->n || v < a->min_us) a->min_us = v;
+  if (!a->n || v > a->max_us) a->max_us = v;
+  a->sum_us += v;
+  a->n++;
+}
+
+/* 핀 관찰: 쓰인 시각 - 목표 시각 */
+static void pin_sink(uint8_t pin, uint8_t level)
+{
+  if (!level) return;
+  int hrt = (pin >= PIN_HRT(0));
+  int e = pin - (hrt ? PIN_HRT(0) : PIN_POLLED(0));
+  if (e < 0 || e >= EDGE_COUNT) return;
+  sc_time_t now = sc_time_us();
+  sc_time_t target = s_req_us + k_edge_us[e];
+  acc_add(&s_err[hrt][e], (uint32_t)(now - target));
+  s_seen++;
+}
+
+/* 폴링 경로: 틱 슬롯 태스크 (arg = 핀) */
+static void polled_edge(void* arg)
+{
+  sc_port_pin_write((uint8_t)(uintptr_t)arg, 1);
+}
+
+/* 전원 요청 (비교 ISR — 틱 사이 임의 시각) */
+static void power_request(void* arg)
+{
+  (void)arg;
+  s_req_us = sc_time_us();
+  for (int e = 0; e < EDGE_COUNT; ++e) {
+    sc_time_t t = s_req_us + k_edge_us[e];
+    sc_hrt_pin_at(t, PIN_HRT(e), 1);
+    sc_add_at_us(&s_sched, polled_edge, (void*)(uintptr_t)PIN_POLLED(e), t, 0);
+  }
+}
+
+static void report(const char* mode, int runs)
+{
+  printf("mode=%s runs=%d tick=1ms\n", mode, runs);
+  printf("%-8s %8s  %-28s %-28s\n", "edge", "target", "polled err us (min/avg/max)", "hrt err us (min/avg/max)");
+  for (int e = 0; e < EDGE_COUNT; ++e) {
+    printf("%-8s %6luus ", k_edge_name[e], (unsigned long)k_edge_us[e]);
+    for (int m = 0; m < 2; ++m) {
+      const err_acc_t* a = &s_err[m][e];
+      if (!a->n) {
+        printf(" %-28s", "-");
+        continue;
+      }
+      char buf[40];
+      snprintf(buf, sizeof(buf), "%lu/%lu/%lu", (unsigned long)a->min_us,
+               (unsigned long)(a->sum_us / a->n), (unsigned long)a->max_us);
+      printf(" %-28s", buf);
+    }
+    printf("\n");
+  }
+
+  sc_hrt_stats_t st;
+  sc_hrt_get_stats(&st);
+  printf("hrt fired=%u full=%u past=%u err_max=%luus\n",
+         st.fired, st.full, st.past, (unsigned long)st.err_max_us);
+}
+
+int main(int argc, char** argv)
+{
+  int realtime = 0;
+  int runs = SIM_RUNS;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--realtime") == 0) realtime = 1;
+    else runs = atoi(argv[i]);
+  }
+  if (runs < 1) runs = 1;
+
+  sc_init(&s_sched, s_slots, SIM_SLOTS);
+  sc_port_tick_start(1, on_tick);
+  sc_port_sim_realtime(realtime);
+  sc_port_sim_pin_sink(pin_sink);
+  sc_hrt_init();
+
+  // run 마다 요청 위상을 틱 안에서 바꿈 (0 ~ 999us, 소수 간격)
+  for (int r = 0; r < runs; ++r) {
+    sc_time_t at = SC_TIME_MS(SIM_RUN_MS) * (sc_time_t)r + 1000u + (sc_time_t)((r * 137u) % 1000u);
+    s_seen = 0;
+    sc_hrt_call_at(at, power_request, NULL);
+    // 실시간 모드에서 기상이 크게 늦어도 다음 요청 전에 이번 엣지를 모두 받는다
+    while (sc_time_us() < at + SC_TIME_MS(SIM_RUN_MS - 1) || s_seen < 2 * EDGE_COUNT) {
+      sc_run(&s_sched, g_tick_ms);
+      sc_port_sleep(sc_port_lock(), SC_SLEEP_LIGHT);
+    }
+  }
+
+  report(realtime ? "realtime" : "virtual", runs);
+  return 0;
+}
@@ -0,0 +1,107 @@
+/* sched_cancel_test.c */
+/*
+ * 실행 중 자기 해제 테스트 (호스트) — sc_cancel() 을 콜백 안에서 부른 뒤 새 워크 등록
+ *
+ *   gcc -O2 -Wall -I../../core sched_cancel_test.c ../../core/sched_core.c ../../core/sched_pool.c ../../core/sched_load.c ../../core/sched_port_host.c -o sched_cancel_test
+ *
+ *   ./sched_cancel_test
+ *
+ * "N 회 뒤 정지" 리핏 워크(풀 컨텍스트)가 마지막 실행에서
+ *   1) 자기 자신을 sc_cancel()
+ *   2) 후속 1회성 워크를 sc_add_ctx_at() 으로 등록
+ *   3) 그 뒤에도 자기 컨텍스트(arg)를 읽음
+ * 을 하는 시나리오를 돌린다. 해제가 콜백 반환 전에 슬롯/블록을 돌려주면 후속 워크가 같은
+ * 슬롯/블록을 받아 (3) 이 덮어쓴 값을 읽고, 반환 후 sc_run 이 후속 워크를 1회성 완료로 보고 지운다.
+ * 검사: 컨텍스트 보존 / 후속 워크 1회 실행 / 해제 대기 중 재개 거부 / 종료 후 슬롯·블록 모두 반환.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "sched_core.h"
+#include "sched_pool.h"
+
+#define TEST_SLOTS   4
+#define TEST_BLOCK   8
+#define TEST_BLOCKS  4
+#define TEST_REPEAT  3      // 리핏 워크 실행 횟수
+#define TEST_END_MS  100
+
+typedef struct {
+  uint32_t magic;
+  uint8_t  left;        ///< 남은 실행 횟수
+  uint8_t  id;          ///< 자기 슬롯 번호
+} rep_ctx_t;
+
+typedef struct {
+  uint32_t magic;
+} next_ctx_t;
+
+#define REP_MAGIC  0x52455031u   // "REP1"
+#define NEXT_MAGIC 0x4E585431u   // "NXT1"
+
+static sc_task_t s_slots[TEST_SLOTS];
+static sc_sched_t s_sched;
+SC_POOL_STORAGE(s_pool_mem, TEST_BLOCK, TEST_BLOCKS);
+static sc_pool_t s_pool;
+static uint32_t s_now;
+
+static int s_rep_runs;
+static int s_next_runs;
+static int s_fail;
+
+static void check(int ok, const char* what) {
+  if (ok) return;
+  printf("  FAIL: %s\n", what);
+  s_fail++;
+}
+
+static void next_work(void* arg) {
+  const next_ctx_t* c = (const next_ctx_t*)arg;
+  check(c->magic == NEXT_MAGIC, "follow-up context");
+  s_next_runs++;
+}
+
+static void rep_work(void* arg) {
+  rep_ctx_t* c = (rep_ctx_t*)arg;
+  check(c->magic == REP_MAGIC, "repeat context before cancel");
+  s_rep_runs++;
+  if (--c->left) return;
+
+  sc_cancel(&s_sched, c->id);
+  check(sc_enable(&s_sched, c->id, true, s_now) < 0, "enable refused while cancel pending");
+
+  next_ctx_t n = { NEXT_MAGIC };
+  int id = sc_add_ctx_at(&s_sched, next_work, &n, sizeof(n), s_now + 10, 0);
+  check(id >= 0, "follow-up registered");
+  check(id != c->id, "follow-up does not reuse the running slot");
+  check(c->magic == REP_MAGIC && c->left == 0, "repeat context after follow-up registered");
+}
+
+int main(void)
+{
+  sc_init(&s_sched, s_slots, TEST_SLOTS);
+  sc_pool_init(&s_pool, s_pool_mem, TEST_BLOCK, TEST_BLOCKS);
+  sc_set_pool(&s_sched, &s_pool);
+
+  /* 콜백이 자기 슬롯 번호를 알 수 있도록: 다음 빈 슬롯 = 0 */
+  rep_ctx_t r = { REP_MAGIC, TEST_REPEAT, 0 };
+  int id = sc_add_ctx_at(&s_sched, rep_work, &r, sizeof(r), 10, 10);
+  check(id == 0, "repeat registered in slot 0");
+
+  for (s_now = 0; s_now <= TEST_END_MS; ++s_now) sc_run(&s_sched, s_now);
+
+  sc_stats_t st;
+  sc_pool_stats_t ps;
+  sc_get_stats(&s_sched, &st);
+  sc_pool_get_stats(&s_pool, &ps);
+
+  check(s_rep_runs == TEST_REPEAT, "repeat ran N times");
+  check(s_next_runs == 1, "follow-up ran once");
+  check(st.used == 0, "all slots returned");
+  check(ps.used == 0, "all pool blocks returned");
+
+  printf("[CANCEL] repeat=%d follow-up=%d slots_used=%u pool_used=%u hwm=%u\n",
+         s_rep_runs, s_next_runs, st.used, ps.used, ps.hwm);
+  printf("[CANCEL] %s\n", s_fail ? "FAIL" : "PASS");
+  return s_fail ? 1 : 0;
+}
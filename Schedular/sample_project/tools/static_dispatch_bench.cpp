@@ -0,0 +1,175 @@
+/* static_dispatch_bench.cpp */
+/*
+ * 주기 태스크 디스패치 벤치마크 (호스트) — 함수 포인터 경로 vs 컴파일 타임 태스크 목록(sched_static.hpp)
+ *
+ *   gcc -O2 -c -DSC_STACK_PAINT_BYTES=0 -I../../core ../../core/sched_core.c ../../core/sched_pool.c ../../core/sched_load.c ../../core/sched_port_host.c
+ *   g++ -std=gnu++17 -O2 -Wall -DSC_STACK_PAINT_BYTES=0 -I../../core static_dispatch_bench.cpp sched_core.o sched_pool.o sched_load.o sched_port_host.o -o static_dispatch_bench
+ *
+ *   (SC_STACK_PAINT_BYTES=0: 슬롯 경로의 스택 칠하기를 빼고 디스패치 비용만 비교)
+ *
+ *   ./static_dispatch_bench [majors]
+ *
+ * Schedulartest.ino 의 프레임 구성(10ms × 2, 50ms × 2 중 하나는 10ms 위상)을 세 방식으로 돌린다.
+ *   slots  : sched_core 주기 슬롯 — sc_run() 이 슬롯 배열을 훑고 fn 간접 호출 (SCHED_CYCLIC=0)
+ *   table  : 마이너 프레임별 const 함수 포인터 테이블 (SCHED_CYCLIC=1)
+ *   static : sc_static_sched 타입 목록 — 직접 호출 (SCHED_CYCLIC=2)
+ * 태스크 본문은 두 가지:
+ *   inline   : 같은 번역 단위의 extern "C" 함수 (static 경로에서 인라인 가능)
+ *   noinline : 다른 번역 단위의 태스크(fault_input_10ms_task 등) 흉내 — 직접 호출 vs 간접 호출 비용만 남음
+ * 출력: 마이너 프레임당 시간(ns), 태스크 호출 수(세 방식 일치 확인), 디스패치 상태 RAM.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "sched_core.h"
+#include "sched_static.hpp"
+
+#define BENCH_MAJORS  2000000   // 50ms 메이저 프레임 반복 수
+#define MINOR_MS      10
+#define FRAME_COUNT   5
+
+static volatile uint32_t s_sink;
+static uint32_t s_calls;
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* ===== 태스크 (C 링키지) ===== */
+extern "C" {
+static void t10_a(void) { s_calls++; s_sink = s_sink + 1; }
+static void t10_b(void) { s_calls++; s_sink = s_sink ^ 0x55; }
+static void t50_a(void) { s_calls++; s_sink = s_sink + 7; }
+static void t50_b(void) { s_calls++; s_sink = s_sink - 3; }
+
+__attribute__((noinline)) void n10_a(void) { s_calls++; s_sink = s_sink + 1; }
+__attribute__((noinline)) void n10_b(void) { s_calls++; s_sink = s_sink ^ 0x55; }
+__attribute__((noinline)) void n50_a(void) { s_calls++; s_sink = s_sink + 7; }
+__attribute__((noinline)) void n50_b(void) { s_calls++; s_sink = s_sink - 3; }
+}
+
+typedef void (*task_fn_t)(void);
+
+/* ===== table: Schedulartest.ino SCHED_CYCLIC=1 과 같은 구조 ===== */
+typedef struct {
+  const task_fn_t* fns;
+  uint8_t          count;
+} frame_t;
+
+#define FRAME(a) { a, (uint8_t)(sizeof(a)/sizeof(a[0])) }
+
+static const task_fn_t s_i_f0[] = { t10_a, t10_b, t50_a };
+static const task_fn_t s_i_f1[] = { t10_a, t10_b, t50_b };
+static const task_fn_t s_i_fn[] = { t10_a, t10_b };
+static const frame_t s_i_frames[FRAME_COUNT] = {
+  FRAME(s_i_f0), FRAME(s_i_f1), FRAME(s_i_fn), FRAME(s_i_fn), FRAME(s_i_fn),
+};
+
+static const task_fn_t s_n_f0[] = { n10_a, n10_b, n50_a };
+static const task_fn_t s_n_f1[] = { n10_a, n10_b, n50_b };
+static const task_fn_t s_n_fn[] = { n10_a, n10_b };
+static const frame_t s_n_frames[FRAME_COUNT] = {
+  FRAME(s_n_f0), FRAME(s_n_f1), FRAME(s_n_fn), FRAME(s_n_fn), FRAME(s_n_fn),
+};
+
+static const size_t k_table_bytes = sizeof(s_i_f0) + sizeof(s_i_f1) + sizeof(s_i_fn) + sizeof(s_i_frames);
+
+__attribute__((noinline)) static void table_run(const frame_t* frames, uint8_t frame)
+{
+  const frame_t* f = &frames[frame];
+  for (uint8_t i = 0; i < f->count; ++i) f->fns[i]();
+}
+
+/* ===== static: 같은 구성을 타입 목록으로 ===== */
+typedef sc_static_sched<MINOR_MS,
+                        sc_static_task<t10_a, 10>,
+                        sc_static_task<t10_b, 10>,
+                        sc_static_task<t50_a, 50>,
+                        sc_static_task<t50_b, 50, 10>> static_inline_t;
+
+typedef sc_static_sched<MINOR_MS,
+                        sc_static_task<n10_a, 10>,
+                        sc_static_task<n10_b, 10>,
+                        sc_static_task<n50_a, 50>,
+                        sc_static_task<n50_b, 50, 10>> static_noinline_t;
+
+static_assert(static_inline_t::frame_count == FRAME_COUNT, "FRAME_COUNT");
+
+/* 프레임 하나 = 함수 하나 (table_run 과 같은 호출 경계에서 비교) */
+__attribute__((noinline)) static void static_inline_run(uint8_t frame)   { static_inline_t::run(frame); }
+__attribute__((noinline)) static void static_noinline_run(uint8_t frame) { static_noinline_t::run(frame); }
+
+/* ===== slots: sched_core 주기 슬롯 ===== */
+static sc_task_t  s_slots[4];
+static sc_sched_t s_sched;
+
+static void slots_init(bool inl)
+{
+  sc_init(&s_sched, s_slots, 4);
+  sc_add0_at(&s_sched, inl ? t10_a : n10_a, 0, 10);
+  sc_add0_at(&s_sched, inl ? t10_b : n10_b, 0, 10);
+  sc_add0_at(&s_sched, inl ? t50_a : n50_a, 0, 50);
+  sc_add0_at(&s_sched, inl ? t50_b : n50_b, 10, 50);
+}
+
+typedef struct {
+  double   ns_per_frame;
+  uint32_t calls;
+} result_t;
+
+template <class F>
+static result_t bench(long majors, F&& minor)
+{
+  s_calls = 0;
+  double t0 = now_ns();
+  for (long m = 0; m < majors; ++m) {
+    for (uint8_t f = 0; f < FRAME_COUNT; ++f) minor(m, f);
+  }
+  double t1 = now_ns();
+  result_t r = { (t1 - t0) / ((double)majors * FRAME_COUNT), s_calls };
+  return r;
+}
+
+static void row(const char* name, const char* body, result_t r, size_t ram, double base)
+{
+  printf("%-7s %-9s %8.2f ns/frame  x%5.2f  calls=%lu  dispatch RAM=%lu B\n",
+         name, body, r.ns_per_frame, base / r.ns_per_frame,
+         (unsigned long)r.calls, (unsigned long)ram);
+}
+
+int main(int argc, char** argv)
+{
+  long majors = (argc > 1) ? atol(argv[1]) : BENCH_MAJORS;
+  if (majors < 1) majors = 1;
+
+  printf("majors=%ld frames/major=%d tasks=4 (10,10,50,50+10)\n", majors, FRAME_COUNT);
+  printf("sizeof(sc_task_t)=%lu, fn ptr=%lu (AVR: 15, 2)\n",
+         (unsigned long)sizeof(sc_task_t), (unsigned long)sizeof(task_fn_t));
+
+  for (int inl = 1; inl >= 0; --inl) {
+    const char* body = inl ? "inline" : "noinline";
+
+    slots_init(inl);
+    result_t rs = bench(majors, [](long m, uint8_t f) {
+      sc_run(&s_sched, (uint32_t)(m * (FRAME_COUNT * MINOR_MS) + f * MINOR_MS));
+    });
+
+    const frame_t* frames = inl ? s_i_frames : s_n_frames;
+    result_t rt = bench(majors, [frames](long, uint8_t f) { table_run(frames, f); });
+
+    result_t rx = inl ? bench(majors, [](long, uint8_t f) { static_inline_run(f); })
+                      : bench(majors, [](long, uint8_t f) { static_noinline_run(f); });
+
+    row("slots",  body, rs, sizeof(s_slots) + sizeof(s_sched), rs.ns_per_frame);
+    row("table",  body, rt, k_table_bytes, rs.ns_per_frame);
+    row("static", body, rx, sizeof(uint8_t), rs.ns_per_frame);
+    if (rs.calls != rt.calls || rt.calls != rx.calls) printf("!! call count mismatch\n");
+  }
+  printf("(static RAM = 프레임 번호 1바이트 — 태스크 목록은 코드에 펼쳐짐)\n");
+  return 0;
+}
@@ -0,0 +1,264 @@
+/* sync_sim.c */
+/*
+ * 보드 간 시각 동기 시뮬레이션 (호스트) — 마스터/슬레이브 2대 + socketpair 시리얼 대역
+ *
+ *   gcc -O2 -Wall -I../../core -I../drivers sync_sim.c ../drivers/tlm_proto.c ../../core/sched_sync.c ../../core/sched_port_host.c -o sync_sim
+ *
+ *   ./sync_sim [skew_ppm] [seconds]      슬레이브 발진자 오차 (기본 +300ppm), 실행 시간 (기본 120s)
+ *   ./sync_sim --reboot [skew_ppm] [s]   중간(절반 시점)에 마스터 재부팅 → 슬레이브 스텝 확인
+ *   ./sync_sim --no-idle [skew_ppm] [s]  마스터 loop() 에 telemetry_idle() 없음 → 50ms 태스크로만 수신 (FAIL 예상)
+ *
+ * 실제 시각을 SIM_STEP_US 로 진행하는 가상 시간 시뮬레이션 (결정적).
+ *   - 보드 시계: 부팅 이후 경과 × (1 + skew) — 슬레이브는 마스터보다 늦게 부팅
+ *   - 링크: socketpair 1쌍 = 시리얼 선. 송신은 UART 처럼 SIM_BYTE_US 마다 1바이트 (57600 8N1)
+ *   - 메인 루프: 태스크가 0 ~ SIM_BUSY_MAX_US 동안 돌고 idle 에서 수신 처리 + sc_sync_poll()
+ *   - 마스터: full_example 과 같이 SIM_TLM_PERIOD_MS 텔레메트리 태스크 + idle (telemetry.c 와 같은 규칙 —
+ *     idle 이 한 번이라도 돌면 수신은 idle 에서만). TLM_CMD_SYNC 요청에 sc_sync_answer() 로 응답
+ *   - 공통 이벤트: SIM_EVENT_MS 마다 두 보드가 같은 순간에 본 에지(공유 Fault 라인)를 각자 스탬프
+ *     → 슬레이브 동기 스탬프 - 마스터 틱 = 상관 오차
+ * 안정화(SIM_SETTLE_S) 이후 |오차| ≤ SIM_ERR_MAX_MS, 동기 시각 단조 + ms 당 +2 이하 (스텝 제외) 이면 PASS.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include "sched_sync.h"
+#include "tlm_proto.h"
+
+#define SIM_STEP_US      10
+#define SIM_BYTE_US      174      // 57600 baud, 10 비트/바이트
+#define SIM_BUSY_MAX_US  3000     // 메인 루프 태스크 구간 최대 (idle 진입 지연)
+#define SIM_EVENT_MS     997      // 공통 이벤트 간격 (라운드와 어긋나게)
+#define SIM_SETTLE_S     10       // 이후 오차 검사
+#define SIM_ERR_MAX_MS   2
+#define SIM_SLAVE_BOOT_US 3217000u
+#define SIM_TLM_PERIOD_MS 50      // 마스터 telemetry_task 드라이버 주기
+
+#define SYNC_PERIOD_MS   1000
+#define SYNC_BURST       4
+#define SYNC_SLEW_MS     100
+#define SYNC_STEP_MS     500
+
+typedef struct {
+  int       fd;
+  int32_t   skew_ppm;
+  uint64_t  boot_us;      // 실제 시각 기준 부팅 시각
+  uint64_t  idle_at;      // 다음 idle 진입 (실제 시각)
+  uint64_t  task_at;      // 다음 텔레메트리 태스크 (실제 시각)
+  uint8_t   idle_rx;      // idle 이 수신을 맡음 (telemetry.c 의 idle_rx)
+  uint8_t   tx[512];      // UART TX 버퍼
+  uint16_t  tx_len, tx_pos;
+  uint64_t  tx_at;
+  uint32_t  tx_bytes;
+  tlm_parser_t parser;
+} board_t;
+
+static board_t   s_master, s_slave;
+static sc_sync_t s_sync;
+static uint64_t  s_now;          // 실제 시각 (us)
+static uint32_t  s_rng = 12345;
+static uint8_t   s_seq;
+
+static uint32_t rnd(uint32_t n)
+{
+  s_rng = s_rng * 1103515245u + 12345u;
+  return (s_rng >> 8) % n;
+}
+
+/* 보드 로컬 시각 (sc_time_us() 역할) */
+static sc_time_t board_us(const board_t* b)
+{
+  if (s_now < b->boot_us) return 0;
+  uint64_t e = s_now - b->boot_us;
+  return (sc_time_t)((int64_t)e + (int64_t)e * b->skew_ppm / 1000000);
+}
+
+static void board_send(board_t* b, const uint8_t* payload, uint8_t len)
+{
+  uint8_t frame[TLM_MAX_FRAME];
+  uint8_t n = tlm_frame_encode(payload, len, frame);
+  if (b->tx_pos == b->tx_len) b->tx_pos = b->tx_len = 0;
+  if (!n || b->tx_len + n > (int)sizeof(b->tx)) return;
+  memcpy(&b->tx[b->tx_len], frame, n);
+  b->tx_len += n;
+}
+
+/* UART: SIM_BYTE_US 마다 1바이트를 선(socketpair)에 올림 */
+static void board_uart(board_t* b)
+{
+  if (b->tx_pos == b->tx_len || s_now < b->tx_at) return;
+  if (write(b->fd, &b->tx[b->tx_pos], 1) == 1) {
+    b->tx_pos++;
+    b->tx_bytes++;
+  }
+  b->tx_at = s_now + SIM_BYTE_US;
+}
+
+/* sc_sync 요청 → TLM_CMD_SYNC 프레임 */
+static void slave_sync_send(const uint8_t* data, uint8_t len)
+{
+  uint8_t p[TLM_MAX_PAYLOAD];
+  p[0] = TLM_CMD_SYNC;
+  p[1] = s_seq++;
+  memcpy(&p[2], data, len);
+  board_send(&s_slave, p, (uint8_t)(len + 2));
+}
+
+/* 수신 바이트 처리 — 프레임 완성 시각이 수신 시각 (telemetry.c tlm_rx) */
+static void board_rx(board_t* b)
+{
+  uint8_t buf[64], p[TLM_MAX_PAYLOAD], len;
+  ssize_t n;
+  while ((n = read(b->fd, buf, sizeof(buf))) > 0) {
+    for (ssize_t i = 0; i < n; i++) {
+      if (tlm_parser_feed(&b->parser, buf[i], p, &len) <= 0) continue;
+      sc_time_t rx = board_us(b);
+      if (b == &s_master && p[0] == TLM_CMD_SYNC) {
+        uint8_t r[TLM_MAX_PAYLOAD];
+        r[0] = TLM_CMD_SYNC | TLM_RESP;
+        r[1] = p[1];
+        r[2] = TLM_ST_OK;
+        uint8_t k = sc_sync_answer(&p[2], (uint8_t)(len - 2), rx, board_us(b), &r[3]);
+        if (!k) r[2] = TLM_ST_BAD_LEN;
+        board_send(b, r, (uint8_t)(k ? k + 3 : 3));
+      } else if (b == &s_slave && p[0] == (TLM_CMD_SYNC | TLM_RESP) && len > 3 && p[2] == TLM_ST_OK) {
+        sc_sync_input(&s_sync, &p[3], (uint8_t)(len - 3), rx);
+      }
+    }
+  }
+}
+
+/* 텔레메트리 태스크: idle 이 수신을 맡기 전까지만 수신 */
+static void board_task(board_t* b)
+{
+  if (!b->idle_rx) board_rx(b);
+}
+
+/* idle: telemetry_idle() — 수신 처리 (+ 슬레이브는 sc_sync_poll) */
+static int board_idle(board_t* b)
+{
+  b->idle_rx = 1;
+  board_rx(b);
+  return (b == &s_slave) ? sc_sync_poll(&s_sync, board_us(b)) : 0;
+}
+
+int main(int argc, char** argv)
+{
+  int reboot = 0, no_idle = 0, argi = 1;
+  for (; argi < argc && strncmp(argv[argi], "--", 2) == 0; argi++) {
+    if (strcmp(argv[argi], "--reboot") == 0) reboot = 1;
+    else if (strcmp(argv[argi], "--no-idle") == 0) no_idle = 1;
+    else { fprintf(stderr, "unknown option %s\n", argv[argi]); return 2; }
+  }
+  int32_t skew = (argi < argc) ? atoi(argv[argi++]) : 300;
+  uint32_t secs = (argi < argc) ? (uint32_t)atoi(argv[argi++]) : 120;
+  if (secs < SIM_SETTLE_S + 5) secs = SIM_SETTLE_S + 5;
+
+  int sv[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) { perror("socketpair"); return 1; }
+  fcntl(sv[0], F_SETFL, O_NONBLOCK);
+  fcntl(sv[1], F_SETFL, O_NONBLOCK);
+  s_master.fd = sv[0];
+  s_slave.fd = sv[1];
+  s_slave.skew_ppm = skew;
+  s_slave.boot_us = SIM_SLAVE_BOOT_US;
+  tlm_parser_init(&s_master.parser);
+  tlm_parser_init(&s_slave.parser);
+  sc_sync_init(&s_sync, slave_sync_send, SYNC_PERIOD_MS, SYNC_BURST, SYNC_SLEW_MS, SYNC_STEP_MS);
+
+  printf("skew=%+ldppm period=%ums burst=%u slew=1ms/%ums step>=%ums master=tlm%ums%s%s\n", (long)skew,
+         SYNC_PERIOD_MS, SYNC_BURST, SYNC_SLEW_MS, SYNC_STEP_MS, SIM_TLM_PERIOD_MS,
+         no_idle ? "" : "+idle", reboot ? " reboot@half" : "");
+  printf("%6s %10s %8s %6s %9s %7s %6s %6s\n",
+         "t_s", "ofs_ms", "err_ms", "left", "drift", "rtt_us", "rounds", "slews");
+
+  uint64_t end = (uint64_t)secs * 1000000u;
+  uint64_t reboot_at = reboot ? end / 2 : 0;
+  uint64_t next_evt = SIM_SLAVE_BOOT_US + SIM_EVENT_MS * 1000u, next_print = 10000000u;
+  uint32_t last_ms = 0, last_stamp = 0, evt_n = 0, evt_bad = 0, mono_bad = 0, rate_bad = 0;
+  int32_t err_max = 0;
+  uint64_t settle_at = SIM_SLAVE_BOOT_US + SIM_SETTLE_S * 1000000u;
+  int have_stamp = 0;
+
+  for (s_now = 0; s_now < end; s_now += SIM_STEP_US) {
+    if (reboot_at && s_now == reboot_at) {
+      s_master.boot_us = s_now;              // 마스터 시계 0 부터 다시
+      s_master.idle_rx = 0;
+      s_master.task_at = s_now;
+      settle_at = s_now + SIM_SETTLE_S * 1000000u;
+      printf("-- master reboot @%lus\n", (unsigned long)(s_now / 1000000u));
+    }
+    board_uart(&s_master);
+    board_uart(&s_slave);
+
+    if (s_now >= s_master.task_at) {
+      board_task(&s_master);
+      s_master.task_at += SIM_TLM_PERIOD_MS * 1000u;
+    }
+    if (s_now >= s_master.idle_at) {
+      if (!no_idle) board_idle(&s_master);
+      s_master.idle_at = s_now + rnd(SIM_BUSY_MAX_US);
+    }
+    if (s_now >= s_slave.boot_us && s_now >= s_slave.idle_at) {
+      if (board_idle(&s_slave)) {
+        have_stamp = 0;                      // 스텝 — 새 시각축 (로그에는 마커 기록)
+        printf("-- step @%lus ofs=%ldms\n", (unsigned long)(s_now / 1000000u), (long)s_sync.ofs_ms);
+      }
+      s_slave.idle_at = s_now + rnd(SIM_BUSY_MAX_US);
+    }
+
+    if (s_now < s_slave.boot_us) continue;
+    uint32_t local_ms = (uint32_t)(board_us(&s_slave) / 1000u);
+
+    // 슬레이브 틱마다 동기 시각 검사: 단조 + 틱당 +2 이하 (1 + 슬루 1)
+    if (local_ms != last_ms) {
+      uint32_t st = sc_sync_stamp(&s_sync, local_ms);
+      if (have_stamp) {
+        if ((int32_t)(st - last_stamp) < 0) mono_bad++;
+        else if (st - last_stamp > (local_ms - last_ms) + 1u) rate_bad++;
+      }
+      last_ms = local_ms;
+      last_stamp = st;
+      have_stamp = 1;
+    }
+
+    if (s_now >= next_evt) {
+      next_evt += SIM_EVENT_MS * 1000u;
+      uint32_t m = (uint32_t)(board_us(&s_master) / 1000u);
+      int32_t e = (int32_t)(sc_sync_stamp(&s_sync, local_ms) - m);
+      if (s_now >= settle_at) {
+        evt_n++;
+        if (e > err_max || -e > err_max) err_max = (e < 0) ? -e : e;
+        if (e > SIM_ERR_MAX_MS || -e > SIM_ERR_MAX_MS) evt_bad++;
+      }
+      if (s_now >= next_print) {
+        next_print += 10000000u;
+        sc_sync_stats_t st;
+        sc_sync_get_stats(&s_sync, &st);
+        printf("%6lu %10ld %8ld %6ld %+7.1fppm %7lu %6u %6u\n", (unsigned long)(s_now / 1000000u),
+               (long)st.ofs_ms, (long)e, (long)st.err_ms, st.drift_ppb / 1000.0,
+               (unsigned long)st.rtt_us, st.rounds, st.slews);
+      }
+    }
+  }
+
+  sc_sync_stats_t st;
+  sc_sync_get_stats(&s_sync, &st);
+  double drift_true = -(double)skew / (1.0 + skew / 1e6);   // 마스터 - 로컬 변화율 (ppm)
+  printf("samples=%u timeouts=%u rejected=%u steps=%u slews=%u\n",
+         st.samples, st.timeouts, st.rejected, st.steps, st.slews);
+  printf("drift est=%+.1fppm true=%+.1fppm  link tx=%lu/%luB (slave/master)\n",
+         st.drift_ppb / 1000.0, drift_true,
+         (unsigned long)s_slave.tx_bytes, (unsigned long)s_master.tx_bytes);
+  printf("events=%lu err_max=%ldms over=%lu  monotonic_bad=%lu rate_bad=%lu\n",
+         (unsigned long)evt_n, (long)err_max, (unsigned long)evt_bad,
+         (unsigned long)mono_bad, (unsigned long)rate_bad);
+
+  int pass = evt_n > 0 && evt_bad == 0 && mono_bad == 0 && rate_bad == 0 &&
+             st.state == SC_SYNC_LOCKED && st.steps == (reboot ? 2 : 1);
+  printf("[SYNC] %s\n", pass ? "PASS" : "FAIL");
+  return pass ? 0 : 1;
+}
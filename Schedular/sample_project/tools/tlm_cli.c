@@ -0,0 +1,362 @@
+/* tlm_cli.c */
+/*
+ * 텔레메트리 호스트 CLI (Linux/macOS)
+ *
+ *   gcc -Wall -I../drivers -I../../core tlm_cli.c ../drivers/tlm_proto.c ../../core/sched_sync.c ../../core/sched_port_host.c -o tlm_cli
+ *
+ *   ./tlm_cli /dev/ttyUSB0 drivers        실제 보드 (57600 8N1)
+ *   ./tlm_cli --sim drivers               pty 대역 장치로 테스트 (보드 없이)
+ *
+ * 명령: ping | sched | faults | drivers | enable <name> <0|1>
+ *       led <rate_ms> | vref <mv> | stream <count> [every_n]
+ *       sync [rounds]      호스트를 슬레이브로 보드(마스터) 시각 오프셋/RTT/드리프트 측정
+ *                          (pty 대역 장치는 SIM_SKEW_PPM 만큼 빠른 시계로 응답)
+ */
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <termios.h>
+#include <time.h>
+#include <sys/wait.h>
+#include "tlm_proto.h"
+#include "sched_sync.h"
+
+#define CLI_TIMEOUT_MS 1000
+#define SIM_SKEW_PPM   250     // pty 대역 장치 발진자 오차
+
+static uint8_t s_seq = 0;
+static tlm_parser_t s_parser;
+
+static const char* const s_status_names[] = {
+  "OK", "BAD_CMD", "BAD_LEN", "NOT_FOUND", "BAD_ARG", "NO_PROVIDER",
+};
+
+static uint32_t now_ms(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000UL + ts.tv_nsec / 1000000UL);
+}
+
+static sc_time_t now_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (sc_time_t)ts.tv_sec * 1000000u + (sc_time_t)(ts.tv_nsec / 1000);
+}
+
+static int set_raw(int fd, int baud)
+{
+  struct termios tio;
+  if (tcgetattr(fd, &tio) != 0) return -1;
+  cfmakeraw(&tio);
+  if (baud) {
+    cfsetispeed(&tio, B57600);
+    cfsetospeed(&tio, B57600);
+  }
+  return tcsetattr(fd, TCSANOW, &tio);
+}
+
+static void send_payload(int fd, const uint8_t* payload, uint8_t len)
+{
+  uint8_t frame[TLM_MAX_FRAME];
+  uint8_t n = tlm_frame_encode(payload, len, frame);
+  if (n && write(fd, frame, n) != n) perror("write");
+}
+
+/* payload 1개 수신 (timeout_ms 안에), 길이 반환 / 0: 타임아웃
+ * 한 번의 read 에 여러 프레임이 오면 남은 바이트는 다음 호출에서 이어서 처리 */
+static uint8_t s_rx[256];
+static ssize_t s_rx_pos = 0, s_rx_len = 0;
+
+static uint8_t recv_payload(int fd, uint8_t* out, int timeout_ms)
+{
+  uint32_t deadline = now_ms() + (uint32_t)timeout_ms;
+  for (;;) {
+    while (s_rx_pos < s_rx_len) {
+      uint8_t len;
+      if (tlm_parser_feed(&s_parser, s_rx[s_rx_pos++], out, &len) > 0) return len;
+    }
+    int left = (int)(deadline - now_ms());
+    if (left <= 0) return 0;
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    if (poll(&pfd, 1, left) <= 0) continue;
+    s_rx_len = read(fd, s_rx, sizeof(s_rx));
+    s_rx_pos = 0;
+    if (s_rx_len < 0) return 0;
+  }
+}
+
+/* 요청 → 같은 seq 응답 대기 (이벤트 프레임은 건너뜀) */
+static int transact(int fd, uint8_t cmd, const uint8_t* arg, uint8_t arg_len, uint8_t* resp)
+{
+  uint8_t req[TLM_MAX_PAYLOAD];
+  uint8_t seq = s_seq++;
+  req[0] = cmd;
+  req[1] = seq;
+  memcpy(&req[2], arg, arg_len);
+  send_payload(fd, req, (uint8_t)(arg_len + 2));
+
+  uint32_t deadline = now_ms() + CLI_TIMEOUT_MS;
+  while ((int)(deadline - now_ms()) > 0) {
+    uint8_t len = recv_payload(fd, resp, (int)(deadline - now_ms()));
+    if (len >= 3 && resp[0] == (cmd | TLM_RESP) && resp[1] == seq) {
+      if (resp[2] != TLM_ST_OK) {
+        fprintf(stderr, "[CLI] status %s\n", resp[2] < 6 ? s_status_names[resp[2]] : "?");
+        return -1;
+      }
+      return len;
+    }
+  }
+  fprintf(stderr, "[CLI] timeout (cmd 0x%02x)\n", cmd);
+  return -1;
+}
+
+/* 시각 동기: 호스트 = 슬레이브, 보드 = 마스터 */
+static int s_sync_fd = -1;
+
+static void cli_sync_send(const uint8_t* data, uint8_t len)
+{
+  uint8_t req[TLM_MAX_PAYLOAD];
+  req[0] = TLM_CMD_SYNC;
+  req[1] = s_seq++;
+  memcpy(&req[2], data, len);
+  send_payload(s_sync_fd, req, (uint8_t)(len + 2));
+}
+
+static void hexdump(const uint8_t* p, int n)
+{
+  for (int i = 0; i < n; i++) printf("%02x%s", p[i], (i % 16 == 15 || i == n - 1) ? "\n" : " ");
+}
+
+static int run_command(int fd, int argc, char** argv)
+{
+  uint8_t resp[TLM_MAX_PAYLOAD];
+  uint8_t arg[TLM_MAX_PAYLOAD];
+  const char* cmd = argv[0];
+  int n;
+
+  if (!strcmp(cmd, "ping")) {
+    if ((n = transact(fd, TLM_CMD_PING, NULL, 0, resp)) < 7) return 1;
+    printf("tick_ms=%lu\n", (unsigned long)tlm_get_u32(&resp[3]));
+
+  } else if (!strcmp(cmd, "sched") || !strcmp(cmd, "faults")) {
+    uint8_t c = (cmd[0] == 's') ? TLM_CMD_GET_SCHED : TLM_CMD_GET_FAULTS;
+    if ((n = transact(fd, c, NULL, 0, resp)) < 3) return 1;
+    hexdump(&resp[3], n - 3);
+
+  } else if (!strcmp(cmd, "drivers")) {
+    uint8_t first = 0, total = 1;
+    printf("idx period en stack name\n");
+    while (first < total) {
+      arg[0] = first;
+      if ((n = transact(fd, TLM_CMD_GET_DRIVERS, arg, 1, resp)) < 4) return 1;
+      total = resp[3];
+      int p = 4;
+      uint8_t got = 0;
+      while (p + 5 < n) {
+        printf("%3u %6u %2u %5u %s\n", resp[p], resp[p + 1], resp[p + 2],
+               tlm_get_u16(&resp[p + 3]), (const char*)&resp[p + 5]);
+        p += 5 + (int)strlen((const char*)&resp[p + 5]) + 1;
+        got++;
+      }
+      if (!got) break;
+      first += got;
+    }
+
+  } else if (!strcmp(cmd, "enable") && argc >= 3) {
+    size_t len = strlen(argv[1]);
+    if (len > 15) return 1;
+    arg[0] = (uint8_t)atoi(argv[2]);
+    memcpy(&arg[1], argv[1], len);
+    if (transact(fd, TLM_CMD_DRV_ENABLE, arg, (uint8_t)(len + 1), resp) < 0) return 1;
+    printf("OK\n");
+
+  } else if ((!strcmp(cmd, "led") || !strcmp(cmd, "vref")) && argc >= 2) {
+    tlm_put_u16(arg, (uint16_t)atoi(argv[1]));
+    if (transact(fd, cmd[0] == 'l' ? TLM_CMD_LED_RATE : TLM_CMD_ADC_VREF, arg, 2, resp) < 0) return 1;
+    printf("OK\n");
+
+  } else if (!strcmp(cmd, "stream") && argc >= 2) {
+    int count = atoi(argv[1]);
+    arg[0] = 1;
+    arg[1] = (uint8_t)((argc >= 3) ? atoi(argv[2]) : 1);
+    if (transact(fd, TLM_CMD_ADC_STREAM, arg, 2, resp) < 0) return 1;
+    for (int got = 0; got < count;) {
+      uint8_t len = recv_payload(fd, resp, CLI_TIMEOUT_MS * 2);
+      if (!len) { fprintf(stderr, "[CLI] stream timeout\n"); break; }
+      if (resp[0] != TLM_EVT_ADC_SAMPLE || len < 8) continue;
+      printf("#%3u t=%8lu raw=%4u\n", resp[1], (unsigned long)tlm_get_u32(&resp[2]), tlm_get_u16(&resp[6]));
+      got++;
+    }
+    arg[0] = 0;
+    transact(fd, TLM_CMD_ADC_STREAM, arg, 2, resp);
+
+  } else if (!strcmp(cmd, "sync")) {
+    int rounds = (argc >= 2) ? atoi(argv[1]) : 10;
+    sc_sync_t sync;
+    sc_sync_stats_t st;
+    uint16_t seen = 0;
+    s_sync_fd = fd;
+    sc_sync_init(&sync, cli_sync_send, 1000, 4, 100, 500);
+    uint32_t deadline = now_ms() + (uint32_t)(rounds + 3) * 1000u;
+    printf("round  board-host_ms  rtt_us  drift_ppm\n");
+    while (sync.rounds < rounds) {
+      if ((int)(deadline - now_ms()) <= 0) { fprintf(stderr, "[CLI] sync timeout\n"); return 1; }
+      uint8_t len = recv_payload(fd, resp, 5);
+      if (len > 3 && resp[0] == (TLM_CMD_SYNC | TLM_RESP) && resp[2] == TLM_ST_OK)
+        sc_sync_input(&sync, &resp[3], (uint8_t)(len - 3), now_us());
+      else if (len >= 3 && resp[0] == (TLM_CMD_SYNC | TLM_RESP))
+        fprintf(stderr, "[CLI] status %s\n", resp[2] < 6 ? s_status_names[resp[2]] : "?");
+      sc_sync_poll(&sync, now_us());
+      if (sync.rounds == seen) continue;
+      seen = sync.rounds;
+      sc_sync_get_stats(&sync, &st);
+      printf("%5u  %13.3f  %6lu  %+9.1f\n", st.rounds, (double)sync.off_us / 1000.0,
+             (unsigned long)st.rtt_us, st.drift_ppb / 1000.0);
+    }
+    sc_sync_get_stats(&sync, &st);
+    printf("samples=%u timeouts=%u rejected=%u\n", st.samples, st.timeouts, st.rejected);
+
+  } else {
+    fprintf(stderr, "unknown command\n");
+    return 2;
+  }
+  return 0;
+}
+
+/* ===== pty 대역 장치 (telemetry.c 와 같은 요청 처리, 하드웨어 값은 가짜) ===== */
+
+typedef struct { char name[16]; uint8_t period; uint8_t enabled; uint16_t stack; } sim_drv_t;
+
+static void sim_device(int fd)
+{
+  sim_drv_t drv[] = { { "LED", 10, 1, 34 }, { "Button", 10, 1, 28 }, { "ADC", 50, 1, 52 } };
+  const uint8_t drv_count = sizeof(drv) / sizeof(drv[0]);
+  uint16_t led_rate = 500, vref_mv = 5000;
+  uint8_t stream_on = 0, stream_every = 1, stream_skip = 0, evt_seq = 0;
+  uint32_t t0 = now_ms(), next_sample = 50;
+  sc_time_t t0_us = now_us();
+  tlm_parser_t parser;
+  tlm_parser_init(&parser);
+
+  for (;;) {
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    poll(&pfd, 1, 5);
+    uint32_t tick = now_ms() - t0;
+    sc_time_t e = now_us() - t0_us;
+    sc_time_t dev_us = e + e * SIM_SKEW_PPM / 1000000u;   // 장치 시계 (sc_time_us 역할)
+
+    uint8_t buf[64];
+    ssize_t n = (pfd.revents & POLLIN) ? read(fd, buf, sizeof(buf)) : 0;
+    if (n < 0) return;
+    for (ssize_t i = 0; i < n; i++) {
+      uint8_t req[TLM_MAX_PAYLOAD], resp[TLM_MAX_PAYLOAD], len;
+      if (tlm_parser_feed(&parser, buf[i], req, &len) <= 0 || req[0] >= TLM_RESP) continue;
+      const uint8_t* arg = &req[2];
+      uint8_t arg_len = (uint8_t)(len - 2), r = 3, st = TLM_ST_OK;
+      resp[0] = req[0] | TLM_RESP;
+      resp[1] = req[1];
+      switch (req[0]) {
+        case TLM_CMD_PING:  tlm_put_u32(&resp[r], tick); r += 4; break;
+        case TLM_CMD_GET_SCHED: tlm_put_u32(&resp[r], tick); r += 4; resp[r++] = drv_count; break;
+        case TLM_CMD_GET_FAULTS: st = TLM_ST_NO_PROVIDER; break;
+        case TLM_CMD_GET_DRIVERS:
+          resp[r++] = drv_count;
+          for (uint8_t k = arg_len ? arg[0] : 0; k < drv_count; k++) {
+            resp[r++] = k; resp[r++] = drv[k].period; resp[r++] = drv[k].enabled;
+            tlm_put_u16(&resp[r], drv[k].stack); r += 2;
+            strcpy((char*)&resp[r], drv[k].name); r += (uint8_t)(strlen(drv[k].name) + 1);
+          }
+          break;
+        case TLM_CMD_DRV_ENABLE: {
+          st = TLM_ST_NOT_FOUND;
+          for (uint8_t k = 0; k < drv_count && arg_len >= 2; k++) {
+            if (strlen(drv[k].name) == (size_t)(arg_len - 1) && !memcmp(drv[k].name, &arg[1], arg_len - 1)) {
+              drv[k].enabled = arg[0] ? 1 : 0;
+              st = TLM_ST_OK;
+            }
+          }
+          break;
+        }
+        case TLM_CMD_LED_RATE: if (arg_len != 2) st = TLM_ST_BAD_LEN; else led_rate = tlm_get_u16(arg); break;
+        case TLM_CMD_ADC_VREF: if (arg_len != 2) st = TLM_ST_BAD_LEN; else vref_mv = tlm_get_u16(arg); break;
+        case TLM_CMD_ADC_STREAM:
+          if (arg_len != 2) { st = TLM_ST_BAD_LEN; break; }
+          stream_on = arg[0]; stream_every = arg[1] ? arg[1] : 1; stream_skip = 0;
+          break;
+        case TLM_CMD_SYNC: {
+          sc_time_t tx = now_us() - t0_us;
+          uint8_t k = sc_sync_answer(arg, arg_len, dev_us, tx + tx * SIM_SKEW_PPM / 1000000u, &resp[r]);
+          if (!k) st = TLM_ST_BAD_LEN;
+          r += k;
+          break;
+        }
+        default: st = TLM_ST_BAD_CMD; break;
+      }
+      resp[2] = st;
+      if (st != TLM_ST_OK) r = 3;
+      send_payload(fd, resp, r);
+    }
+
+    if (tick >= next_sample) {
+      next_sample += 50;  // ADC 드라이버 50ms
+      if (stream_on && ++stream_skip >= stream_every) {
+        uint8_t evt[8];
+        stream_skip = 0;
+        evt[0] = TLM_EVT_ADC_SAMPLE;
+        evt[1] = evt_seq++;
+        tlm_put_u32(&evt[2], tick);
+        tlm_put_u16(&evt[6], (uint16_t)(512 + (tick / 50 % 64) * 4));
+        send_payload(fd, evt, sizeof(evt));
+      }
+    }
+    (void)led_rate; (void)vref_mv;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <tty|--sim> <command> [args]\n", argv[0]);
+    return 2;
+  }
+
+  int fd;
+  pid_t child = -1;
+  if (!strcmp(argv[1], "--sim")) {
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) || unlockpt(master)) { perror("pty"); return 1; }
+    fd = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (fd < 0 || set_raw(fd, 0)) { perror("pty slave"); return 1; }
+    child = fork();
+    if (child == 0) {
+      close(fd);
+      sim_device(master);
+      _exit(0);
+    }
+    close(master);
+  } else {
+    fd = open(argv[1], O_RDWR | O_NOCTTY);
+    if (fd < 0 || set_raw(fd, 1)) { perror(argv[1]); return 1; }
+    usleep(2000 * 1000);  // 포트 open 시 보드 리셋(DTR) 대기
+  }
+
+  tlm_parser_init(&s_parser);
+  int rc = run_command(fd, argc - 2, &argv[2]);
+
+  close(fd);
+  if (child > 0) {
+    kill(child, SIGTERM);
+    waitpid(child, NULL, 0);
+  }
+  return rc;
+}